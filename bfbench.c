@@ -0,0 +1,188 @@
+/**
+ * @author Henry Díaz Bordón
+ * @version 0.1.0
+ * @note Run as `./bfbench ./brainfuck program.bf...`, or simply `make
+ * bench-bf`. Every program is run BENCH_RUNS times per execution mode with its
+ * output discarded, and the fastest run of each is printed as a tab-separated
+ * line:
+ *   program  mode  seconds  commands  commands_per_sec  max_rss_kb
+ * `commands` is the number of Brainfuck commands the program executes, as
+ * counted by `-O0 --profile=0`; modes the interpreter cannot run (the JIT on
+ * a foreign platform) are left out.
+ */
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BRED "\e[1;31m"
+#define RES "\e[0m"
+
+#define panic(...)                                                             \
+    do                                                                         \
+    {                                                                          \
+        fprintf(stderr, __VA_ARGS__);                                          \
+        exit(EXIT_FAILURE);                                                    \
+    } while (0)
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS 1
+#endif
+
+#define REPORT_SIZE 4096
+
+typedef struct __mode_struct
+{
+    const char *name;
+    const char *flag;
+} bench_mode_t;
+
+const bench_mode_t MODES[] = {
+    {"source", "-O0"},
+    {"switch", "--switch"},
+    {"ir", NULL},
+    {"jit", "--jit"},
+};
+
+typedef struct __run_struct
+{
+    double seconds;
+    long max_rss_kb;
+    int status;
+    char report[REPORT_SIZE];
+} run_t;
+
+/**
+ * Runs `interp [flag [flag2]] -f program` with stdin and stdout tied to
+ * /dev/null, collecting its wall time, peak RSS and whatever it wrote to
+ * stderr.
+ */
+run_t run(const char *interp, const char *flag, const char *flag2,
+          const char *program)
+{
+    run_t r = {.seconds = 0, .max_rss_kb = 0, .status = 0, .report = ""};
+    const char *argv[6];
+    int argc = 0;
+
+    argv[argc++] = interp;
+    if (flag)
+        argv[argc++] = flag;
+    if (flag2)
+        argv[argc++] = flag2;
+    argv[argc++] = "-f";
+    argv[argc++] = program;
+    argv[argc] = NULL;
+
+    int err[2];
+    if (pipe(err))
+        panic(BRED "RUNTIME ERROR:" RES " Could not create a pipe.\n");
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pid_t pid = fork();
+    if (pid < 0)
+        panic(BRED "RUNTIME ERROR:" RES " Could not fork.\n");
+    if (pid == 0)
+    {
+        int null = open("/dev/null", O_RDWR);
+        dup2(null, STDIN_FILENO);
+        dup2(null, STDOUT_FILENO);
+        dup2(err[1], STDERR_FILENO);
+        close(err[0]);
+        execv(interp, (char *const *)argv);
+        _exit(127);
+    }
+
+    // Keep the head of the report and drain the rest, so a chatty child
+    // never blocks on a full pipe.
+    close(err[1]);
+    size_t len = 0;
+    ssize_t n;
+    char sink[256];
+    while (len < REPORT_SIZE - 1 &&
+           (n = read(err[0], r.report + len, REPORT_SIZE - 1 - len)) > 0)
+        len += n;
+    while (read(err[0], sink, sizeof(sink)) > 0)
+        ;
+    r.report[len] = '\0';
+    close(err[0]);
+
+    struct rusage usage;
+    if (wait4(pid, &r.status, 0, &usage) < 0)
+        panic(BRED "RUNTIME ERROR:" RES " Could not wait for \"%s\".\n",
+              interp);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    r.seconds =
+        (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    r.max_rss_kb = usage.ru_maxrss;
+    return r;
+}
+
+_Bool failed(const run_t *r)
+{
+    return !WIFEXITED(r->status) || WEXITSTATUS(r->status) != 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        printf("Usage: %s interpreter program.bf...\n", argv[0]);
+        return 1;
+    }
+
+    const char *interp = argv[1];
+    printf("program\tmode\tseconds\tcommands\tcommands_per_sec\tmax_rss_kb\n");
+    fflush(stdout);
+
+    for (int arg = 2; arg < argc; arg++)
+    {
+        const char *program = argv[arg];
+
+        run_t count = run(interp, "-O0", "--profile=0", program);
+        unsigned long long commands;
+        if (failed(&count) ||
+            sscanf(count.report, "%llu commands executed", &commands) != 1)
+            panic(BRED "RUNTIME ERROR:" RES " Could not count the commands "
+                       "of \"%s\".\n",
+                  program);
+
+        for (size_t m = 0; m < sizeof(MODES) / sizeof(MODES[0]); m++)
+        {
+            run_t best;
+            for (int i = 0; i < BENCH_RUNS; i++)
+            {
+                run_t r = run(interp, MODES[m].flag, NULL, program);
+                if (failed(&r))
+                    panic(BRED "RUNTIME ERROR:" RES " \"%s\" failed in %s "
+                               "mode.\n",
+                          program, MODES[m].name);
+                if (i == 0 || r.seconds < best.seconds)
+                    best = r;
+            }
+
+            // The interpreter falls back to the IR, and says so, when it
+            // cannot JIT; that run would only duplicate the `ir` line.
+            if (MODES[m].flag && !strcmp(MODES[m].flag, "--jit") &&
+                strstr(best.report, "JIT not available"))
+                continue;
+
+            printf("%s\t%s\t%.6f\t%llu\t%.0f\t%ld\n", program, MODES[m].name,
+                   best.seconds, commands, commands / best.seconds,
+                   best.max_rss_kb);
+            fflush(stdout);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+/**
+ * @author Henry Díaz Bordón
+ * @version 0.1.0
+ * @note To compile a Brainfuck program, run `./bfc file.bf [output.s]; gcc
+ * output.s -o output`.
+ */
+#include "brainfuck.h"
+
+char BF_PROGRAM_START_CODE[] = ".intel_syntax noprefix\n\n"
+                               ".section .bss\n"
+                               "tape: .zero %d\n\n"
+                               ".section .text\n"
+                               ".global main\n"
+                               "main:\n"
+                               "    push rbx\n"
+                               "    lea rbx, [rip + tape]\n";
+
+char BF_PROGRAM_END_CODE[] =
+    "    xor eax, eax\n"
+    "    pop rbx\n"
+    "    ret\n\n"
+    ".Loff_tape:\n"
+    "    xor edi, edi\n"
+    "    call fflush@PLT\n"
+    "    lea rdi, [rip + off_tape_msg]\n"
+    "    mov rsi, qword ptr [rip + stderr@GOTPCREL]\n"
+    "    mov rsi, qword ptr [rsi]\n"
+    "    call fputs@PLT\n"
+    "    mov edi, 1\n"
+    "    call exit@PLT\n\n"
+    ".section .rodata\n"
+    "off_tape_msg: .asciz \"\\033[1;31mRUNTIME ERROR:\\033[0m Tape pointer "
+    "left the tape.\\n\"\n\n"
+    ".section .note.GNU-stack,\"\",@progbits\n";
+
+char *read_source(const char *path, uint32_t *len)
+{
+    FILE *fptr = fopen(path, "rb");
+    if (!fptr)
+        panic(BRED "RUNTIME ERROR:" RES " Could not open file \"%s\".\n", path);
+
+    fseek(fptr, 0L, SEEK_END);
+    *len = ftell(fptr);
+    fseek(fptr, 0L, SEEK_SET);
+
+    char *src = malloc(*len + 1);
+    if (!src || fread(src, 1, *len, fptr) != *len)
+        panic(BRED "RUNTIME ERROR:" RES " Could not read file \"%s\".\n", path);
+    src[*len] = '\0';
+
+    fclose(fptr);
+    return src;
+}
+
+/**
+ * Emits one IR instruction as straight-line x86-64. The tape pointer lives in
+ * rbx; loops are labelled after the index of their opening bracket.
+ */
+void emit_asm(FILE *out, const instr_t *code, uint32_t pc)
+{
+    const instr_t *in = code + pc;
+
+    switch (in->op)
+    {
+    case OP_ADD:
+        fprintf(out, "    add byte ptr [rbx + %d], %d\n", in->off,
+                (uint8_t)in->arg);
+        break;
+
+    case OP_MOVE:
+        fprintf(out, "    add rbx, %d\n", in->arg);
+        break;
+
+    case OP_OUT:
+        fprintf(out, "    movzx edi, byte ptr [rbx + %d]\n", in->off);
+        fprintf(out, "    call putchar@PLT\n");
+        break;
+
+    case OP_IN:
+        fprintf(out, "    call getchar@PLT\n"
+                     "    cmp eax, -1\n"
+                     "    je .Lin%u\n",
+                pc);
+        fprintf(out, "    mov byte ptr [rbx + %d], al\n", in->off);
+        fprintf(out, ".Lin%u:\n", pc);
+        break;
+
+    case OP_JZ:
+        fprintf(out, "    cmp byte ptr [rbx + %d], 0\n", in->off);
+        fprintf(out, "    je .Lend%u\n", pc);
+        fprintf(out, ".Lbegin%u:\n", pc);
+        break;
+
+    case OP_JNZ:
+        fprintf(out, "    cmp byte ptr [rbx + %d], 0\n", in->off);
+        fprintf(out, "    jne .Lbegin%u\n", in->jmp);
+        fprintf(out, ".Lend%u:\n", in->jmp);
+        break;
+
+    case OP_CLEAR:
+        fprintf(out, "    mov byte ptr [rbx + %d], 0\n", in->off);
+        break;
+
+    case OP_MUL:
+        fprintf(out, "    movzx eax, byte ptr [rbx + %d]\n", in->from);
+        if (in->arg != 1)
+            fprintf(out, "    imul eax, eax, %d\n", in->arg);
+        fprintf(out, "    add byte ptr [rbx + %d], al\n", in->off);
+        break;
+
+    case OP_SCAN:
+        // Like the interpreter, a scan that starts or ends off the tape is
+        // an error rather than a walk through whatever memory follows.
+        fprintf(out, ".Lscan%u:\n", pc);
+        fprintf(out, "    lea rax, [rip + tape]\n"
+                     "    mov rcx, rbx\n"
+                     "    sub rcx, rax\n");
+        fprintf(out, "    cmp rcx, %d\n", MEMORY_SIZE);
+        fprintf(out, "    jae .Loff_tape\n");
+        if (in->arg == 1 || in->arg == -1)
+        {
+            if (in->arg == 1)
+                fprintf(out, "    mov rdi, rbx\n"
+                             "    lea rdx, [rip + tape + %d]\n"
+                             "    sub rdx, rbx\n",
+                        MEMORY_SIZE);
+            else
+                fprintf(out, "    lea rdi, [rip + tape]\n"
+                             "    lea rdx, [rbx + 1]\n"
+                             "    sub rdx, rdi\n");
+            fprintf(out, "    xor esi, esi\n"
+                         "    call %s@PLT\n",
+                    in->arg == 1 ? "memchr" : "memrchr");
+            fprintf(out, "    test rax, rax\n"
+                         "    jz .Loff_tape\n"
+                         "    mov rbx, rax\n");
+            break;
+        }
+        fprintf(out, "    cmp byte ptr [rbx], 0\n");
+        fprintf(out, "    je .Lscanned%u\n", pc);
+        fprintf(out, "    add rbx, %d\n", in->arg);
+        fprintf(out, "    jmp .Lscan%u\n", pc);
+        fprintf(out, ".Lscanned%u:\n", pc);
+        break;
+
+    case OP_END:
+        break;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        printf("Usage: %s file.bf [output.s]\n", argv[0]);
+        return 1;
+    }
+
+    uint32_t len;
+    char *pgm = read_source(argv[1], &len);
+    program_t prog = compile(pgm, len);
+
+    FILE *out = fopen(argc > 2 ? argv[2] : "output.s", "w");
+    if (!out)
+        panic(BRED "RUNTIME ERROR:" RES " Could not open output file.\n");
+
+    fprintf(out, BF_PROGRAM_START_CODE, MEMORY_SIZE);
+    for (uint32_t pc = 0; pc < prog.len; pc++)
+        emit_asm(out, prog.code, pc);
+    fputs(BF_PROGRAM_END_CODE, out);
+
+    fclose(out);
+    free(prog.code);
+    free(pgm);
+
+    return 0;
+}
@@ -2,37 +2,345 @@
  * @author Henry Díaz Bordón
  * @version 1.0.0
  * @note Huge thanks to Kyryl Shyshko for his clever insights and bug-fixing.
+ * @note Run as `./brainfuck [options] program`, where `program` is the source
+ * itself or, with `-f`, the name of a file holding it. Options:
+ *   -O0                   interpret the source directly, without the IR.
+ *   --jit                 compile the IR to x86-64 and run it natively.
+ *   --switch              run the IR with a plain switch loop instead of
+ *                         threaded code.
+ *   --eof=0|-1|unchanged  what `,` stores at end of input (default unchanged).
+ *   --flush-on-input      flush output before every `,` (implied on a tty).
+ *   --huge-tape           use a guarded HUGE_TAPE_SIZE tape, not MEMORY_SIZE.
+ *   --profile[=N]         interpret with counters and print the N (default
+ *                         10) hottest loops to stderr at exit.
+ *   --batch               treat `program` as a manifest of `file.bf [input]`
+ *                         lines and run them all on a pool of threads.
  */
-#ifndef MEMORY_SIZE
-#define MEMORY_SIZE 30000
+#define _GNU_SOURCE
+
+#if defined(__x86_64__) && defined(__unix__)
+#define JIT_SUPPORTED
 #endif
 
-#include <stdint.h>
-#include <stdio.h>
+#if defined(__GNUC__) && !defined(NO_THREADED_CODE)
+#define THREADED_CODE
+#endif
 
-int main(int argc, char **argv)
+#include "brainfuck.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifndef HUGE_TAPE_SIZE
+#define HUGE_TAPE_SIZE (1u << 30)
+#endif
+
+#ifndef TAPE_GUARD_SIZE
+#define TAPE_GUARD_SIZE (1ul << 30)
+#endif
+
+#ifndef PROFILE_SNIPPET
+#define PROFILE_SNIPPET 40
+#endif
+
+#ifndef IO_BUFFER_SIZE
+#define IO_BUFFER_SIZE (1 << 16)
+#endif
+
+#define ERROR_SIZE 256
+
+typedef enum __eof_enum
 {
-    if (argc < 2)
-        return 1;
+    EOF_UNCHANGED,
+    EOF_ZERO,
+    EOF_MINUS_ONE
+} eof_t;
 
-    uint8_t mem[MEMORY_SIZE] = {0};
-    uint32_t p = 0;
+typedef enum __mode_enum
+{
+    MODE_SOURCE,
+    MODE_IR,
+    MODE_SWITCH,
+    MODE_JIT
+} exec_mode_t;
+
+/**
+ * Program I/O goes through two fixed buffers that are moved with plain
+ * read(2)/write(2) calls, so `.` and `,` cost a byte copy instead of a trip
+ * through stdio's format parser. An `out_fd` of -1 captures the output in
+ * a growing `capture` buffer instead, and an `in_fd` of -1 is an empty
+ * input, both for `--batch`.
+ */
+typedef struct __io_struct
+{
+    int in_fd;
+    int out_fd;
+    eof_t eof;
+    _Bool flush_on_input;
+    uint32_t in_pos;
+    uint32_t in_len;
+    uint32_t out_len;
+    uint8_t *capture;
+    size_t captured;
+    size_t capture_cap;
+    uint8_t in[IO_BUFFER_SIZE];
+    uint8_t out[IO_BUFFER_SIZE];
+} io_t;
+
+/**
+ * Execution counts gathered by `--profile`: one per IR instruction (or per
+ * source byte under -O0), plus the loop iterations each idiom replaced.
+ */
+typedef struct __profile_struct
+{
+    uint64_t *counts;
+    uint64_t *iters;
+} profile_t;
+
+typedef struct __loop_struct
+{
+    uint32_t src;
+    uint64_t entries;
+    uint64_t iterations;
+    const char *idiom;
+} loop_t;
+
+typedef struct __vm_struct
+{
+    uint8_t *mem;
+    uint32_t size;
+    io_t io;
+    sigjmp_buf *escape; // where a tape error unwinds to, in batch jobs
+    void *code;         // threaded code or JIT mapping of the current run
+    size_t code_len;
+} vm_t;
+
+void io_flush(io_t *io)
+{
+    if (io->out_fd < 0)
+    {
+        if (io->captured + io->out_len > io->capture_cap)
+        {
+            io->capture_cap = 2 * (io->captured + io->out_len);
+            io->capture = realloc(io->capture, io->capture_cap);
+            if (!io->capture)
+                panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+        }
+        memcpy(io->capture + io->captured, io->out, io->out_len);
+        io->captured += io->out_len;
+        io->out_len = 0;
+        return;
+    }
+
+    for (uint32_t done = 0; done < io->out_len;)
+    {
+        ssize_t n = write(io->out_fd, io->out + done, io->out_len - done);
+        if (n < 0 && errno != EINTR)
+            break;
+        if (n > 0)
+            done += n;
+    }
+    io->out_len = 0;
+}
+
+static inline void io_put(io_t *io, uint8_t c)
+{
+    if (io->out_len == IO_BUFFER_SIZE)
+        io_flush(io);
+    io->out[io->out_len++] = c;
+}
+
+void io_get(io_t *io, uint8_t *cell)
+{
+    if (io->flush_on_input)
+        io_flush(io);
+
+    if (io->in_pos == io->in_len && io->in_fd >= 0)
+    {
+        ssize_t n;
+        while ((n = read(io->in_fd, io->in, IO_BUFFER_SIZE)) < 0 &&
+               errno == EINTR)
+            ;
+        io->in_pos = 0;
+        io->in_len = n > 0 ? n : 0;
+    }
+
+    if (io->in_pos < io->in_len)
+        *cell = io->in[io->in_pos++];
+    else if (io->eof == EOF_ZERO)
+        *cell = 0;
+    else if (io->eof == EOF_MINUS_ONE)
+        *cell = 255;
+}
+
+// Lanes `first`, `first + step`, ... of a 16-byte block.
+uint32_t lane_mask(int32_t first, int32_t step)
+{
+    uint32_t mask = 0;
+    for (; first >= 0 && first < 16; first += step)
+        mask |= 1u << first;
+    return mask;
+}
+
+/**
+ * Runs `while (mem[p]) p += stride` without dispatching once per cell.
+ * Unit strides go through memchr/memrchr; strides of up to 16 compare 16
+ * cells at a time with SSE2, masking off the lanes the loop never visits.
+ * Leaving the tape is reported instead of reading past it.
+ */
+uint32_t scan_tape(vm_t *vm, uint32_t p, int32_t stride)
+{
+    const uint8_t *mem = vm->mem, *z;
+    uint32_t s = stride < 0 ? -stride : stride;
+
+    if (p >= vm->size)
+        goto off_tape;
+
+    if (stride == 1)
+    {
+        if ((z = memchr(mem + p, 0, vm->size - p)))
+            return z - mem;
+        p = vm->size;
+    }
+#ifdef __GLIBC__
+    else if (stride == -1)
+    {
+        if ((z = memrchr(mem, 0, p + 1)))
+            return z - mem;
+        p = UINT32_MAX;
+    }
+#endif
+#ifdef __SSE2__
+    else if (s <= 16)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        uint32_t jump = s * ((16 + s - 1) / s);
+        uint32_t mask, lanes = stride > 0 ? lane_mask(0, s) : lane_mask(15, -s);
 
-    uint32_t stack[1 << 8];
-    uint32_t sp = 0;
+        if (stride > 0)
+        {
+            for (; p + 16 <= vm->size; p += jump)
+            {
+                mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i *)(mem + p)), zero));
+                if ((mask &= lanes))
+                    return p + __builtin_ctz(mask);
+            }
+        }
+        else
+        {
+            for (; p >= 15 && p < vm->size; p -= jump)
+            {
+                mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i *)(mem + p - 15)), zero));
+                if ((mask &= lanes))
+                    return p - 15 + 31 - __builtin_clz(mask);
+            }
+        }
+    }
+#endif
+
+    // A backwards scan past cell 0 wraps around and also ends the loop.
+    for (; p < vm->size; p += stride)
+        if (!mem[p])
+            return p;
 
-    char *pgm = argv[1];
+off_tape:
+    if (vm->escape)
+        siglongjmp(*vm->escape, 1);
+    io_flush(&vm->io);
+    panic(BRED "RUNTIME ERROR:" RES " Tape pointer left the tape.\n");
+}
 
-    for (uint32_t pc = 0; pgm[pc]; pc++)
+void run_ir(const instr_t *code, vm_t *vm, profile_t *prof)
+{
+    uint8_t *p = vm->mem, *q;
+
+    for (uint32_t pc = 0;; pc++)
     {
+        if (prof)
+            prof->counts[pc]++;
+
+        switch (code[pc].op)
+        {
+        case OP_ADD:
+            p[code[pc].off] += code[pc].arg;
+            break;
+
+        case OP_MOVE:
+            p += code[pc].arg;
+            break;
+
+        case OP_OUT:
+            io_put(&vm->io, p[code[pc].off]);
+            break;
+
+        case OP_IN:
+            io_get(&vm->io, p + code[pc].off);
+            break;
+
+        case OP_JZ:
+            if (!p[code[pc].off])
+                pc = code[pc].jmp;
+            break;
+
+        case OP_JNZ:
+            if (p[code[pc].off])
+                pc = code[pc].jmp;
+            break;
+
+        case OP_CLEAR:
+            q = p + code[pc].off;
+            if (prof)
+                prof->iters[pc] += (uint8_t)(code[pc].arg == 1 ? -*q : *q);
+            *q = 0;
+            break;
+
+        case OP_MUL:
+            p[code[pc].off] += p[code[pc].from] * code[pc].arg;
+            break;
+
+        case OP_SCAN:
+            q = vm->mem + scan_tape(vm, p - vm->mem, code[pc].arg);
+            if (prof)
+                prof->iters[pc] += (q - p) / code[pc].arg;
+            p = q;
+            break;
+
+        case OP_END:
+            return;
+        }
+    }
+}
+
+void run_source(const char *pgm, uint32_t len, const uint32_t *match,
+                vm_t *vm, profile_t *prof)
+{
+    uint8_t *p = vm->mem;
+
+    for (uint32_t pc = 0; pc < len; pc++)
+    {
+        if (prof)
+            prof->counts[pc]++;
+
         switch (pgm[pc])
         {
         case '+':
-            mem[p]++;
+            (*p)++;
             break;
 
         case '-':
-            mem[p]--;
+            (*p)--;
             break;
 
         case '>':
@@ -44,38 +352,880 @@ int main(int argc, char **argv)
             break;
 
         case '.':
-            printf("%c", mem[p]);
+            io_put(&vm->io, *p);
             break;
 
         case ',':
-            scanf("%c", mem + p);
+            io_get(&vm->io, p);
             break;
 
         case '[':
-            if (!mem[p])
+            if (!*p)
+                pc = match[pc];
+            break;
+
+        case ']':
+            if (*p)
+                pc = match[pc];
+            break;
+        }
+    }
+}
+
+#ifdef THREADED_CODE
+/**
+ * One IR instruction translated for `run_threaded`: the address of its
+ * handler plus inline operands. Jumps point straight at the instruction to
+ * resume at, so a taken branch costs no index arithmetic.
+ */
+typedef struct __thread_op_struct
+{
+    const void *handler;
+    int32_t arg;
+    int32_t off;
+    int32_t from;
+    const struct __thread_op_struct *jmp;
+} thread_op_t;
+
+/**
+ * Runs the IR as direct-threaded code (GCC labels as values). Every handler
+ * ends in its own indirect jump to the next one, so the branch predictor
+ * sees one dispatch site per instruction kind instead of a single shared
+ * one at the top of a switch.
+ */
+void run_threaded(const program_t *prog, vm_t *vm)
+{
+    static const void *const handlers[] = {
+        [OP_ADD] = &&op_add,     [OP_MOVE] = &&op_move, [OP_OUT] = &&op_out,
+        [OP_IN] = &&op_in,       [OP_JZ] = &&op_jz,     [OP_JNZ] = &&op_jnz,
+        [OP_CLEAR] = &&op_clear, [OP_MUL] = &&op_mul,   [OP_SCAN] = &&op_scan,
+        [OP_END] = &&op_end,
+    };
+    thread_op_t *code = vm->code = malloc(prog->len * sizeof(thread_op_t));
+    const thread_op_t *ip = code;
+    uint8_t *p = vm->mem;
+
+    if (!code)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+
+    for (uint32_t pc = 0; pc < prog->len; pc++)
+    {
+        const instr_t *in = prog->code + pc;
+        code[pc] = (thread_op_t){handlers[in->op], in->arg, in->off, in->from,
+                                 NULL};
+        if (in->op == OP_JZ || in->op == OP_JNZ)
+            code[pc].jmp = code + in->jmp + 1;
+    }
+
+#define DISPATCH() goto *ip->handler
+#define NEXT()                                                                 \
+    do                                                                         \
+    {                                                                          \
+        ip++;                                                                  \
+        DISPATCH();                                                            \
+    } while (0)
+
+    DISPATCH();
+
+op_add:
+    p[ip->off] += ip->arg;
+    NEXT();
+
+op_move:
+    p += ip->arg;
+    NEXT();
+
+op_out:
+    io_put(&vm->io, p[ip->off]);
+    NEXT();
+
+op_in:
+    io_get(&vm->io, p + ip->off);
+    NEXT();
+
+op_jz:
+    ip = p[ip->off] ? ip + 1 : ip->jmp;
+    DISPATCH();
+
+op_jnz:
+    ip = p[ip->off] ? ip->jmp : ip + 1;
+    DISPATCH();
+
+op_clear:
+    p[ip->off] = 0;
+    NEXT();
+
+op_mul:
+    p[ip->off] += p[ip->from] * ip->arg;
+    NEXT();
+
+op_scan:
+    p = vm->mem + scan_tape(vm, p - vm->mem, ip->arg);
+    NEXT();
+
+op_end:
+#undef NEXT
+#undef DISPATCH
+    free(code);
+    vm->code = NULL;
+}
+#endif
+
+#ifdef JIT_SUPPORTED
+typedef struct __jit_struct
+{
+    uint8_t *code;
+    size_t len;
+    size_t cap;
+} jit_t;
+
+void jit_putchar(vm_t *vm, uint8_t c)
+{
+    io_put(&vm->io, c);
+}
+
+void jit_getchar(vm_t *vm, uint8_t *cell)
+{
+    io_get(&vm->io, cell);
+}
+
+uint8_t *jit_scan(vm_t *vm, uint8_t *cell, int32_t stride)
+{
+    return vm->mem + scan_tape(vm, cell - vm->mem, stride);
+}
+
+void jit_bytes(jit_t *jit, const uint8_t *bytes, size_t n)
+{
+    memcpy(jit->code + jit->len, bytes, n);
+    jit->len += n;
+}
+
+void jit_dword(jit_t *jit, uint32_t v)
+{
+    jit_bytes(jit, (const uint8_t *)&v, 4);
+}
+
+// ModRM (and displacement) for `[rbx + off]` with `reg` in the reg field.
+void jit_cell(jit_t *jit, uint8_t reg, int32_t off)
+{
+    if (!off)
+        jit->code[jit->len++] = (reg << 3) | 3;
+    else if (off >= -128 && off < 128)
+    {
+        jit->code[jit->len++] = 0x40 | (reg << 3) | 3;
+        jit->code[jit->len++] = (uint8_t)off;
+    }
+    else
+    {
+        jit->code[jit->len++] = 0x80 | (reg << 3) | 3;
+        jit_dword(jit, off);
+    }
+}
+
+void jit_call(jit_t *jit, void *fn)
+{
+    jit_bytes(jit, (const uint8_t[]){0x48, 0xB8}, 2); // mov rax, imm64
+    jit_bytes(jit, (const uint8_t *)&fn, 8);
+    jit_bytes(jit, (const uint8_t[]){0xFF, 0xD0}, 2); // call rax
+}
+
+/**
+ * Translates the IR into x86-64 machine code. The tape pointer lives in
+ * rbx and the VM in r12 for the whole run; I/O and scans call back into the
+ * `jit_*` helpers. The result is a `void (uint8_t *mem, vm_t *vm)` function
+ * in an executable mapping.
+ */
+jit_t jit_compile(const program_t *prog)
+{
+    jit_t jit = {.code = NULL, .len = 0, .cap = 32 * (prog->len + 4)};
+    uint32_t *native = malloc(prog->len * sizeof(uint32_t));
+
+    jit.code = mmap(NULL, jit.cap, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (jit.code == MAP_FAILED || !native)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+
+    // push rbx; push r12; sub rsp, 8; mov rbx, rdi; mov r12, rsi
+    jit_bytes(&jit,
+              (const uint8_t[]){0x53, 0x41, 0x54, 0x48, 0x83, 0xEC, 0x08, 0x48,
+                                0x89, 0xFB, 0x49, 0x89, 0xF4},
+              13);
+
+    for (uint32_t pc = 0; pc < prog->len; pc++)
+    {
+        const instr_t *in = prog->code + pc;
+        int32_t rel;
+
+        native[pc] = jit.len;
+
+        switch (in->op)
+        {
+        case OP_ADD:
+            jit.code[jit.len++] = 0x80; // add byte [rbx + off], imm8
+            jit_cell(&jit, 0, in->off);
+            jit.code[jit.len++] = (uint8_t)in->arg;
+            break;
+
+        case OP_MOVE:
+            jit_bytes(&jit, (const uint8_t[]){0x48, 0x81, 0xC3}, 3);
+            jit_dword(&jit, in->arg); // add rbx, imm32
+            break;
+
+        case OP_OUT:
+            jit_bytes(&jit, (const uint8_t[]){0x4C, 0x89, 0xE7}, 3);
+            jit_bytes(&jit, (const uint8_t[]){0x0F, 0xB6}, 2);
+            jit_cell(&jit, 6, in->off); // movzx esi, byte [rbx + off]
+            jit_call(&jit, (void *)jit_putchar); // jit_putchar(r12, esi)
+            break;
+
+        case OP_IN:
+            jit_bytes(&jit, (const uint8_t[]){0x4C, 0x89, 0xE7, 0x48, 0x8D},
+                      5);
+            jit_cell(&jit, 6, in->off); // mov rdi, r12; lea rsi, [rbx + off]
+            jit_call(&jit, (void *)jit_getchar); // jit_getchar(r12, rsi)
+            break;
+
+        case OP_JZ:
+            // cmp byte [rbx + off], 0; je <patched by the matching OP_JNZ>
+            jit.code[jit.len++] = 0x80;
+            jit_cell(&jit, 7, in->off);
+            jit_bytes(&jit, (const uint8_t[]){0x00, 0x0F, 0x84}, 3);
+            jit_dword(&jit, 0);
+            native[pc] = jit.len; // the loop body, right after the rel32
+            break;
+
+        case OP_JNZ:
+            // cmp byte [rbx + off], 0; jne <body of the loop>
+            jit.code[jit.len++] = 0x80;
+            jit_cell(&jit, 7, in->off);
+            jit_bytes(&jit, (const uint8_t[]){0x00, 0x0F, 0x85}, 3);
+            jit_dword(&jit, native[in->jmp] - (jit.len + 4));
+            rel = jit.len - native[in->jmp];
+            memcpy(jit.code + native[in->jmp] - 4, &rel, 4);
+            break;
+
+        case OP_CLEAR:
+            jit.code[jit.len++] = 0xC6; // mov byte [rbx + off], 0
+            jit_cell(&jit, 0, in->off);
+            jit.code[jit.len++] = 0;
+            break;
+
+        case OP_MUL:
+            jit_bytes(&jit, (const uint8_t[]){0x0F, 0xB6}, 2);
+            jit_cell(&jit, 0, in->from); // movzx eax, byte [rbx + from]
+            if (in->arg != 1)
             {
-                uint32_t l = 0;
-                do
-                {
-                    if (pgm[pc] == '[')
-                        l++;
-                    if (pgm[pc] == ']')
-                        l--;
-                    pc++;
-                } while (l);
-                pc--;
+                jit_bytes(&jit, (const uint8_t[]){0x69, 0xC0}, 2);
+                jit_dword(&jit, in->arg); // imul eax, eax, imm32
             }
-            else
-                stack[sp++] = pc - 1;
+            jit.code[jit.len++] = 0x00; // add byte [rbx + off], al
+            jit_cell(&jit, 0, in->off);
             break;
 
-        case ']':
-            sp--;
-            if (mem[p])
-                pc = stack[sp];
+        case OP_SCAN:
+            // mov rdi, r12; mov rsi, rbx; mov edx, stride
+            jit_bytes(&jit,
+                      (const uint8_t[]){0x4C, 0x89, 0xE7, 0x48, 0x89, 0xDE,
+                                        0xBA},
+                      7);
+            jit_dword(&jit, in->arg);
+            jit_call(&jit, (void *)jit_scan);
+            jit_bytes(&jit, (const uint8_t[]){0x48, 0x89, 0xC3}, 3);
             break;
+
+        case OP_END:
+            // add rsp, 8; pop r12; pop rbx; ret
+            jit_bytes(&jit,
+                      (const uint8_t[]){0x48, 0x83, 0xC4, 0x08, 0x41, 0x5C,
+                                        0x5B, 0xC3},
+                      8);
+            break;
+        }
+    }
+
+    free(native);
+
+    if (mprotect(jit.code, jit.cap, PROT_READ | PROT_EXEC))
+        panic(BRED "RUNTIME ERROR:" RES " Could not map JIT code.\n");
+
+    return jit;
+}
+
+void run_jit(const program_t *prog, vm_t *vm)
+{
+    jit_t jit = jit_compile(prog);
+    vm->code = jit.code;
+    vm->code_len = jit.cap;
+    ((void (*)(uint8_t *, vm_t *))jit.code)(vm->mem, vm);
+    munmap(jit.code, jit.cap);
+    vm->code = NULL;
+}
+#endif
+
+int compare_loops(const void *a, const void *b)
+{
+    uint64_t x = ((const loop_t *)a)->iterations;
+    uint64_t y = ((const loop_t *)b)->iterations;
+    return (x < y) - (x > y);
+}
+
+/**
+ * Prints the `top` loops with the most iterations, keyed by the offset of
+ * their `[`. Loops the optimizer replaced are listed with the idiom they
+ * became; their iterations are the ones the plain loop would have run.
+ */
+void print_profile(const char *pgm, uint32_t len, const uint32_t *match,
+                   const program_t *prog, const profile_t *prof, uint32_t top)
+{
+    uint32_t n = 0, size = prog ? prog->len : len;
+    uint64_t total = 0;
+    loop_t *loops = malloc(size * sizeof(loop_t) + 1);
+
+    if (!loops)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+
+    for (uint32_t pc = 0; pc < size; pc++)
+    {
+        if (!prog)
+        {
+            total += is_command(pgm[pc]) ? prof->counts[pc] : 0;
+            if (pgm[pc] == '[')
+                loops[n++] = (loop_t){pc, prof->counts[pc],
+                                      prof->counts[match[pc]], NULL};
+            continue;
+        }
+
+        const instr_t *in = prog->code + pc;
+        total += prof->counts[pc];
+
+        if (in->op == OP_JZ)
+            loops[n++] = (loop_t){in->src, prof->counts[pc],
+                                  prof->counts[in->jmp], NULL};
+        else if (in->op == OP_SCAN)
+            loops[n++] = (loop_t){in->src, prof->counts[pc], prof->iters[pc],
+                                  "scan"};
+        else if (in->op == OP_CLEAR)
+            loops[n++] = (loop_t){
+                in->src, prof->counts[pc], prof->iters[pc],
+                pc && in[-1].op == OP_MUL && in[-1].src == in->src ? "multiply"
+                                                                   : "clear"};
+    }
+
+    qsort(loops, n, sizeof(loop_t), compare_loops);
+
+    fprintf(stderr, "\n%llu %s executed, %u loops.\n",
+            (unsigned long long)total, prog ? "IR instructions" : "commands",
+            n);
+    if (n && top)
+        fprintf(stderr, "%14s %12s %10s %-9s %s\n", "iterations", "entries",
+                "offset", "idiom", "source");
+
+    for (uint32_t i = 0; i < n && i < top; i++)
+    {
+        char snippet[PROFILE_SNIPPET + 4];
+        uint32_t k = 0, depth = 0;
+
+        for (uint32_t pc = loops[i].src; pc < len && k < PROFILE_SNIPPET;
+             pc++)
+        {
+            if (!is_command(pgm[pc]))
+                continue;
+            snippet[k++] = pgm[pc];
+            depth += pgm[pc] == '[' ? 1 : pgm[pc] == ']' ? -1 : 0;
+            if (!depth)
+                break;
         }
+        if (depth)
+            snippet[k++] = '.', snippet[k++] = '.', snippet[k++] = '.';
+        snippet[k] = '\0';
+
+        fprintf(stderr, "%14llu %12llu %10u %-9s %s\n",
+                (unsigned long long)loops[i].iterations,
+                (unsigned long long)loops[i].entries, loops[i].src,
+                loops[i].idiom ? loops[i].idiom : "-", snippet);
+    }
+
+    free(loops);
+}
+
+// The VM whose guarded tape this thread runs on, if any.
+__thread vm_t *guarded_vm = NULL;
+
+/**
+ * Reserves `size` cells between two PROT_NONE guard regions. Pages are only
+ * committed when first touched, and a pointer that walks off either end
+ * faults in a guard instead of corrupting memory, so moves stay unchecked.
+ */
+uint8_t *map_tape(uint32_t size)
+{
+    uint8_t *base =
+        mmap(NULL, size + 2 * TAPE_GUARD_SIZE, PROT_NONE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (base == MAP_FAILED ||
+        mprotect(base + TAPE_GUARD_SIZE, size, PROT_READ | PROT_WRITE))
+        panic(BRED "RUNTIME ERROR:" RES " Could not reserve the tape.\n");
+
+    return base + TAPE_GUARD_SIZE;
+}
+
+void tape_fault(int sig, siginfo_t *info, void *ctx)
+{
+    static const char msg[] =
+        BRED "RUNTIME ERROR:" RES " Tape pointer left the tape.\n";
+    uint8_t *addr = info->si_addr;
+    vm_t *vm = guarded_vm;
+
+    (void)ctx;
+
+    if (vm && addr >= vm->mem - TAPE_GUARD_SIZE &&
+        addr < vm->mem + vm->size + TAPE_GUARD_SIZE)
+    {
+        if (vm->escape)
+            siglongjmp(*vm->escape, 1);
+        io_flush(&vm->io);
+        ssize_t n = write(STDERR_FILENO, msg, sizeof(msg) - 1);
+        (void)n;
+        _exit(EXIT_FAILURE);
+    }
+
+    // Not ours: let the fault happen again with the default action.
+    signal(sig, SIG_DFL);
+}
+
+void guard_tape(vm_t *vm)
+{
+    struct sigaction sa;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = tape_fault;
+    sa.sa_flags = SA_SIGINFO;
+    sigemptyset(&sa.sa_mask);
+
+    guarded_vm = vm;
+    sigaction(SIGSEGV, &sa, NULL);
+    sigaction(SIGBUS, &sa, NULL);
+}
+
+/**
+ * Maps a program file read-only instead of copying it. Comments and
+ * whitespace are skipped by the bracket/IR pre-pass, so nothing but the
+ * mapping itself depends on their size. Returns NULL, with the reason in
+ * `error`, if the file cannot be mapped.
+ */
+char *map_source(const char *path, uint32_t *len, char *error)
+{
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    char *pgm = NULL;
+
+    if (fd < 0 || fstat(fd, &st))
+        snprintf(error, ERROR_SIZE,
+                 BRED "RUNTIME ERROR:" RES " Could not open file \"%s\".",
+                 path);
+    else if ((uint64_t)st.st_size >= UINT32_MAX)
+        snprintf(error, ERROR_SIZE,
+                 BRED "RUNTIME ERROR:" RES " File \"%s\" is too large.", path);
+    else if (!(*len = st.st_size))
+        pgm = "";
+    else if ((pgm = mmap(NULL, *len, PROT_READ, MAP_PRIVATE, fd, 0)) ==
+             MAP_FAILED)
+    {
+        pgm = NULL;
+        snprintf(error, ERROR_SIZE,
+                 BRED "RUNTIME ERROR:" RES " Could not map file \"%s\".",
+                 path);
     }
+    else
+        madvise(pgm, *len, MADV_SEQUENTIAL);
+
+    if (fd >= 0)
+        close(fd);
+    return pgm;
+}
+
+/**
+ * Runs a whole program in the given mode, without profiling. With
+ * `recover` set, a tape error ends the run instead of the process, and
+ * everything the run allocated is dropped; returns false if it did so.
+ */
+_Bool execute(const char *pgm, uint32_t len, exec_mode_t mode, vm_t *vm,
+              _Bool recover)
+{
+    sigjmp_buf escape;
+    uint32_t *match = NULL;
+    program_t prog = {.code = NULL, .len = 0, .cap = 0};
+
+    if (mode == MODE_SOURCE)
+        match = match_brackets(pgm, len);
+    else
+        prog = compile(pgm, len);
+
+    vm->code = NULL;
+    vm->escape = NULL;
+    if (recover && sigsetjmp(escape, 1))
+    {
+#ifdef JIT_SUPPORTED
+        if (mode == MODE_JIT)
+            munmap(vm->code, vm->code_len);
+        else
+#endif
+            free(vm->code);
+        free(match);
+        free(prog.code);
+        vm->escape = NULL;
+        return false;
+    }
+    if (recover)
+        vm->escape = &escape;
+
+    switch (mode)
+    {
+    case MODE_SOURCE:
+        run_source(pgm, len, match, vm, NULL);
+        break;
+#ifdef JIT_SUPPORTED
+    case MODE_JIT:
+        run_jit(&prog, vm);
+        break;
+#endif
+#ifdef THREADED_CODE
+    case MODE_IR:
+        run_threaded(&prog, vm);
+        break;
+#endif
+    default:
+        run_ir(prog.code, vm, NULL);
+        break;
+    }
+
+    free(match);
+    free(prog.code);
+    vm->escape = NULL;
+    return true;
+}
+
+typedef struct __job_struct
+{
+    char *program;
+    char *input;
+    uint8_t *output;
+    size_t len;
+    int status; // EXIT_SUCCESS, or EXIT_FAILURE with `error` set
+    char error[ERROR_SIZE];
+    _Bool done;
+} job_t;
+
+typedef struct __batch_struct
+{
+    job_t *jobs;
+    uint32_t count;
+    uint32_t next;
+    exec_mode_t mode;
+    eof_t eof;
+    pthread_mutex_t lock;
+    pthread_cond_t done;
+} batch_t;
+
+/**
+ * Takes jobs off the batch until none are left. Each worker owns one VM
+ * and one guarded tape, which is cleared between jobs; output is captured
+ * and handed back in the job. A job that cannot be read, does not parse or
+ * walks off the tape fails on its own, with whatever it wrote so far and
+ * the reason in its `error`. Scans are checked against the tape's ends;
+ * other accesses only fault once they leave the pages it was mapped on.
+ */
+void *batch_worker(void *data)
+{
+    batch_t *batch = data;
+    vm_t *vm = malloc(sizeof(vm_t));
+    uint8_t *mem = map_tape(MEMORY_SIZE);
+
+    if (!vm)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+    vm->mem = mem;
+    vm->size = MEMORY_SIZE;
+    vm->escape = NULL;
+    guard_tape(vm);
+
+    for (;;)
+    {
+        pthread_mutex_lock(&batch->lock);
+        uint32_t i = batch->next++;
+        pthread_mutex_unlock(&batch->lock);
+        if (i >= batch->count)
+            break;
+
+        job_t *job = batch->jobs + i;
+        uint32_t len = 0;
+        char *pgm = map_source(job->program, &len, job->error);
+
+        memset(mem, 0, MEMORY_SIZE);
+        vm->mem = mem;
+        vm->size = MEMORY_SIZE;
+        vm->io.in_fd = -1;
+        vm->io.out_fd = -1;
+        vm->io.eof = batch->eof;
+        vm->io.flush_on_input = false;
+        vm->io.in_pos = vm->io.in_len = vm->io.out_len = 0;
+        vm->io.capture = NULL;
+        vm->io.captured = vm->io.capture_cap = 0;
+
+        if (!pgm)
+            job->status = EXIT_FAILURE;
+        else if (!check_brackets(pgm, len, job->error, ERROR_SIZE))
+            job->status = EXIT_FAILURE;
+        else if (job->input &&
+                 (vm->io.in_fd = open(job->input, O_RDONLY)) < 0)
+        {
+            snprintf(job->error, ERROR_SIZE,
+                     BRED "RUNTIME ERROR:" RES " Could not open file \"%s\".",
+                     job->input);
+            job->status = EXIT_FAILURE;
+        }
+        else if (!execute(pgm, len, batch->mode, vm, true))
+        {
+            snprintf(job->error, ERROR_SIZE,
+                     BRED "RUNTIME ERROR:" RES " Tape pointer left the tape.");
+            job->status = EXIT_FAILURE;
+        }
+        io_flush(&vm->io);
+
+        if (vm->io.in_fd >= 0)
+            close(vm->io.in_fd);
+        if (pgm && len)
+            munmap(pgm, len);
+
+        pthread_mutex_lock(&batch->lock);
+        job->output = vm->io.capture;
+        job->len = vm->io.captured;
+        job->done = true;
+        pthread_cond_broadcast(&batch->done);
+        pthread_mutex_unlock(&batch->lock);
+    }
+
+    munmap(mem - TAPE_GUARD_SIZE, MEMORY_SIZE + 2 * TAPE_GUARD_SIZE);
+    free(vm);
+    return NULL;
+}
+
+/**
+ * Runs every program listed in `manifest`, one `file.bf [input]` per line
+ * (blank lines and lines starting with `#` are skipped), on one worker per
+ * online CPU. Without an input file a job sees end of input at once. The
+ * output of each job is printed after a `==> file.bf (N bytes) <==` header,
+ * in manifest order, as soon as it and every job before it have finished,
+ * followed by its error if it failed. The batch fails if any job did.
+ */
+int run_batch(const char *manifest, exec_mode_t mode, eof_t eof)
+{
+    batch_t batch = {.jobs = NULL, .count = 0, .next = 0, .mode = mode,
+                     .eof = eof};
+    uint32_t cap = 0;
+    int status = EXIT_SUCCESS;
+    FILE *list = fopen(manifest, "r");
+    char *line = NULL;
+    size_t line_cap = 0;
+
+    if (!list)
+        panic(BRED "RUNTIME ERROR:" RES " Could not open file \"%s\".\n",
+              manifest);
+
+    while (getline(&line, &line_cap, list) >= 0)
+    {
+        char *save, *program = strtok_r(line, " \t\r\n", &save);
+        char *input = strtok_r(NULL, " \t\r\n", &save);
+
+        if (!program || program[0] == '#')
+            continue;
+
+        if (batch.count == cap)
+        {
+            cap = cap ? 2 * cap : 64;
+            batch.jobs = realloc(batch.jobs, cap * sizeof(job_t));
+            if (!batch.jobs)
+                panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+        }
+        batch.jobs[batch.count++] = (job_t){
+            .program = strdup(program),
+            .input = input ? strdup(input) : NULL,
+            .output = NULL,
+            .len = 0,
+            .status = EXIT_SUCCESS,
+            .error = "",
+            .done = false,
+        };
+    }
+    free(line);
+    fclose(list);
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t workers = cpus > 0 ? cpus : 1;
+    if (workers > batch.count)
+        workers = batch.count;
+    pthread_t *threads = malloc(workers * sizeof(pthread_t) + 1);
+
+    if (!threads)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+
+    pthread_mutex_init(&batch.lock, NULL);
+    pthread_cond_init(&batch.done, NULL);
+    for (uint32_t w = 0; w < workers; w++)
+        if (pthread_create(threads + w, NULL, batch_worker, &batch))
+            panic(BRED "RUNTIME ERROR:" RES " Could not start a worker.\n");
+
+    for (uint32_t i = 0; i < batch.count; i++)
+    {
+        job_t *job = batch.jobs + i;
+
+        pthread_mutex_lock(&batch.lock);
+        while (!job->done)
+            pthread_cond_wait(&batch.done, &batch.lock);
+        pthread_mutex_unlock(&batch.lock);
+
+        printf("==> %s (%zu bytes) <==\n", job->program, job->len);
+        fwrite(job->output, 1, job->len, stdout);
+        if (job->status != EXIT_SUCCESS)
+        {
+            if (job->len && job->output[job->len - 1] != '\n')
+                putchar('\n');
+            printf("%s\n", job->error);
+            status = job->status;
+        }
+        fflush(stdout);
+
+        free(job->output);
+        free(job->program);
+        free(job->input);
+    }
+
+    for (uint32_t w = 0; w < workers; w++)
+        pthread_join(threads[w], NULL);
+    pthread_mutex_destroy(&batch.lock);
+    pthread_cond_destroy(&batch.done);
+    free(threads);
+    free(batch.jobs);
+
+    return status;
+}
+
+int main(int argc, char **argv)
+{
+    exec_mode_t mode = MODE_IR;
+    eof_t eof = EOF_UNCHANGED;
+    _Bool flush_on_input = false;
+    _Bool from_file = false;
+    _Bool huge_tape = false;
+    _Bool profile = false;
+    _Bool batch = false;
+    uint32_t top = 10;
+    int arg = 1;
+
+    for (; arg < argc - 1; arg++)
+    {
+        if (!strcmp(argv[arg], "-O0"))
+            mode = MODE_SOURCE;
+        else if (!strcmp(argv[arg], "--jit"))
+            mode = MODE_JIT;
+        else if (!strcmp(argv[arg], "--switch"))
+            mode = MODE_SWITCH;
+        else if (!strcmp(argv[arg], "--flush-on-input"))
+            flush_on_input = true;
+        else if (!strcmp(argv[arg], "--eof=0"))
+            eof = EOF_ZERO;
+        else if (!strcmp(argv[arg], "--eof=-1"))
+            eof = EOF_MINUS_ONE;
+        else if (!strcmp(argv[arg], "--eof=unchanged"))
+            eof = EOF_UNCHANGED;
+        else if (!strcmp(argv[arg], "-f"))
+            from_file = true;
+        else if (!strcmp(argv[arg], "--huge-tape"))
+            huge_tape = true;
+        else if (!strcmp(argv[arg], "--profile"))
+            profile = true;
+        else if (!strncmp(argv[arg], "--profile=", 10))
+        {
+            profile = true;
+            top = strtoul(argv[arg] + 10, NULL, 10);
+        }
+        else if (!strcmp(argv[arg], "--batch"))
+            batch = true;
+        else
+            break;
+    }
+
+    if (arg >= argc)
+        return 1;
+
+#ifndef JIT_SUPPORTED
+    if (mode == MODE_JIT && !profile)
+        fprintf(stderr, "JIT not available on this platform.\n");
+#endif
+    if (batch)
+        return run_batch(argv[arg], mode, eof);
+
+    static vm_t vm;
+    uint8_t mem[MEMORY_SIZE] = {0};
+    vm.mem = mem;
+    vm.size = MEMORY_SIZE;
+    if (huge_tape)
+    {
+        vm.mem = map_tape(HUGE_TAPE_SIZE);
+        vm.size = HUGE_TAPE_SIZE;
+        guard_tape(&vm);
+    }
+    vm.io.in_fd = STDIN_FILENO;
+    vm.io.out_fd = STDOUT_FILENO;
+    vm.io.eof = eof;
+    vm.io.flush_on_input = flush_on_input || isatty(STDIN_FILENO);
+    uint32_t len;
+    char *pgm = argv[arg];
+
+    if (from_file)
+    {
+        static char error[ERROR_SIZE];
+        if (!(pgm = map_source(pgm, &len, error)))
+            panic("%s\n", error);
+    }
+    else
+        len = strlen(pgm);
+
+    if (!profile)
+    {
+        execute(pgm, len, mode, &vm, false);
+        io_flush(&vm.io);
+        return 0;
+    }
+
+    profile_t prof = {.counts = NULL, .iters = NULL};
+
+    if (mode == MODE_SOURCE)
+    {
+        uint32_t *match = match_brackets(pgm, len);
+
+        prof.counts = calloc(len + 1, sizeof(uint64_t));
+        if (!prof.counts)
+            panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+        run_source(pgm, len, match, &vm, &prof);
+
+        io_flush(&vm.io);
+        print_profile(pgm, len, match, NULL, &prof, top);
+
+        free(match);
+        return 0;
+    }
+
+    program_t prog = compile(pgm, len);
+
+    prof.counts = calloc(prog.len, sizeof(uint64_t));
+    prof.iters = calloc(prog.len, sizeof(uint64_t));
+    if (!prof.counts || !prof.iters)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+    run_ir(prog.code, &vm, &prof);
+
+    io_flush(&vm.io);
+    print_profile(pgm, len, NULL, &prog, &prof, top);
 
+    free(prog.code);
     return 0;
-}
\ No newline at end of file
+}
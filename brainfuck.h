@@ -0,0 +1,343 @@
+/**
+ * @author Henry Díaz Bordón
+ * @version 1.0.0
+ * @note Brainfuck front end (bracket matching and the optimizing IR) shared by
+ * the interpreter and the `bfc` compiler.
+ */
+#ifndef BRAINFUCK_H
+#define BRAINFUCK_H
+
+#define BRED "\e[1;31m"
+#define RES "\e[0m"
+
+#define panic(...)                                                             \
+    do                                                                         \
+    {                                                                          \
+        fprintf(stderr, __VA_ARGS__);                                          \
+        exit(EXIT_FAILURE);                                                    \
+    } while (0)
+
+#ifndef MEMORY_SIZE
+#define MEMORY_SIZE 30000
+#endif
+
+#define MAX_IDIOM_CELLS 32
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum __op_enum
+{
+    OP_ADD,   // mem[p + off] += arg
+    OP_MOVE,  // p += arg
+    OP_OUT,   // putchar(mem[p + off])
+    OP_IN,    // mem[p + off] = getchar()
+    OP_JZ,    // if (!mem[p + off]) goto jmp
+    OP_JNZ,   // if (mem[p + off]) goto jmp
+    OP_CLEAR, // mem[p + off] = 0 (arg is the replaced loop's step, 1 or -1)
+    OP_MUL,   // mem[p + off] += mem[p + from] * arg
+    OP_SCAN,  // while (mem[p]) p += arg
+    OP_END
+} op_t;
+
+typedef struct __instr_struct
+{
+    uint8_t op;
+    int32_t arg;
+    int32_t off;
+    int32_t from;
+    uint32_t jmp;
+    uint32_t src;
+} instr_t;
+
+typedef struct __program_struct
+{
+    instr_t *code;
+    uint32_t len;
+    uint32_t cap;
+} program_t;
+
+static const _Bool COMMANDS[256] = {['+'] = true, ['-'] = true,
+                                    ['>'] = true, ['<'] = true,
+                                    ['.'] = true, [','] = true,
+                                    ['['] = true, [']'] = true};
+
+static inline _Bool is_command(char c)
+{
+    return COMMANDS[(uint8_t)c];
+}
+
+/**
+ * Pairs every `[` with its `]` (and vice versa) so that loop jumps take
+ * constant time. Unbalanced programs are rejected before running.
+ */
+static inline uint32_t *match_brackets(const char *pgm, uint32_t len)
+{
+    uint32_t *match = malloc(len * sizeof(uint32_t) + 1);
+    uint32_t *stack = malloc(len * sizeof(uint32_t) + 1);
+    uint32_t sp = 0;
+
+    if (!match || !stack)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+
+    for (uint32_t pc = 0; pc < len; pc++)
+    {
+        if (pgm[pc] == '[')
+            stack[sp++] = pc;
+        else if (pgm[pc] == ']')
+        {
+            if (!sp)
+                panic(BRED "SYNTAX ERROR:" RES " Unmatched ']' at %u.\n", pc);
+            match[pc] = stack[--sp];
+            match[match[pc]] = pc;
+        }
+    }
+
+    if (sp)
+        panic(BRED "SYNTAX ERROR:" RES " Unmatched '[' at %u.\n",
+              stack[sp - 1]);
+
+    free(stack);
+    return match;
+}
+
+/**
+ * Checks that every bracket has a partner without building anything, for
+ * callers that must not exit on a syntax error. Returns false, with the
+ * same message match_brackets would print in `error`, if one does not.
+ */
+static inline _Bool check_brackets(const char *pgm, uint32_t len, char *error,
+                                   size_t size)
+{
+    uint32_t depth = 0;
+
+    for (uint32_t pc = 0; pc < len; pc++)
+    {
+        if (pgm[pc] == '[')
+            depth++;
+        else if (pgm[pc] == ']' && !depth--)
+        {
+            snprintf(error, size,
+                     BRED "SYNTAX ERROR:" RES " Unmatched ']' at %u.", pc);
+            return false;
+        }
+    }
+
+    if (depth)
+    {
+        // The innermost unmatched `[` is the last one no `]` closes.
+        uint32_t pc = len, closing = 0;
+        while (pc--)
+            if (pgm[pc] == ']')
+                closing++;
+            else if (pgm[pc] == '[' && !closing--)
+                break;
+        snprintf(error, size,
+                 BRED "SYNTAX ERROR:" RES " Unmatched '[' at %u.", pc);
+        return false;
+    }
+
+    return true;
+}
+
+static inline uint32_t emit(program_t *prog, uint8_t op, int32_t arg,
+                            int32_t off, uint32_t src)
+{
+    if (prog->len == prog->cap)
+    {
+        prog->cap = prog->cap ? 2 * prog->cap : 256;
+        prog->code = realloc(prog->code, prog->cap * sizeof(instr_t));
+        if (!prog->code)
+            panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+    }
+
+    prog->code[prog->len] = (instr_t){
+        .op = op, .arg = arg, .off = off, .from = 0, .jmp = 0, .src = src};
+    return prog->len++;
+}
+
+/**
+ * Recognizes loops made only of `+-<>` that return to their starting cell
+ * and step it by one per iteration (`[-]`, `[->+>++<<]`, ...). Such a loop
+ * runs exactly `mem[p]` (or `-mem[p]`) times, so it is lowered to one
+ * multiply-accumulate per touched cell followed by a clear, all addressed
+ * from the pending pointer offset `*base`. Loops that only move the pointer
+ * (`[>]`, `[<<]`, ...) become a zero-cell scan, which needs the real pointer,
+ * so the pending offset is emitted first. Returns the position of the
+ * closing `]` or 0 if the loop is not an idiom.
+ */
+static inline uint32_t compile_idiom(program_t *prog, const char *pgm,
+                                     uint32_t len, uint32_t pc, int32_t *base)
+{
+    int32_t offs[MAX_IDIOM_CELLS], deltas[MAX_IDIOM_CELLS];
+    uint32_t start = pc, cells = 1;
+    int32_t p = 0;
+
+    offs[0] = deltas[0] = 0;
+
+    for (pc++; pc < len && pgm[pc] != ']'; pc++)
+    {
+        switch (pgm[pc])
+        {
+        case '>':
+            p++;
+            continue;
+
+        case '<':
+            p--;
+            continue;
+
+        case '+':
+        case '-':
+            break;
+
+        case '.':
+        case ',':
+        case '[':
+            return 0;
+
+        default:
+            continue;
+        }
+
+        uint32_t c = 0;
+        while (c < cells && offs[c] != p)
+            c++;
+        if (c == cells)
+        {
+            if (cells == MAX_IDIOM_CELLS)
+                return 0;
+            offs[cells] = p;
+            deltas[cells++] = 0;
+        }
+        deltas[c] += pgm[pc] == '+' ? 1 : -1;
+    }
+
+    if (pc == len)
+        return 0;
+
+    uint8_t step = deltas[0];
+    if (p)
+    {
+        for (uint32_t c = 0; c < cells; c++)
+            if ((uint8_t)deltas[c])
+                return 0;
+        if (*base)
+            emit(prog, OP_MOVE, *base, 0, start);
+        *base = 0;
+        emit(prog, OP_SCAN, p, 0, start);
+        return pc;
+    }
+
+    if (step != 1 && step != 255)
+        return 0;
+
+    for (uint32_t c = 1; c < cells; c++)
+    {
+        uint8_t factor = step == 255 ? deltas[c] : -deltas[c];
+        if (factor)
+        {
+            uint32_t mul = emit(prog, OP_MUL, factor, *base + offs[c], start);
+            prog->code[mul].from = *base;
+        }
+    }
+    emit(prog, OP_CLEAR, step == 1 ? 1 : -1, *base, start);
+
+    return pc;
+}
+
+/**
+ * Lowers the source into a compact IR: runs of `+-` fold into a single
+ * `OP_ADD`, clear and multiply loops become straight-line code, and every
+ * remaining bracket carries the index of its partner.
+ *
+ * Pointer movement is deferred: `<>` only shift the offset `off` at which
+ * the following instructions address the tape, so `>+>++<<-` becomes three
+ * adds at offsets 1, 2 and 0 with no move at all. A loop is entered with
+ * the pending offset as is, and its `]` moves the pointer by whatever the
+ * body left over, so balanced loops run without any pointer arithmetic.
+ */
+static inline program_t compile(const char *pgm, uint32_t len)
+{
+    program_t prog = {.code = NULL, .len = 0, .cap = 0};
+    uint32_t *stack = malloc(len * sizeof(uint32_t) + 1);
+    int32_t *bases = malloc(len * sizeof(int32_t) + 1);
+    uint32_t sp = 0;
+    int32_t off = 0;
+
+    if (!stack || !bases)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.\n");
+
+    for (uint32_t pc = 0; pc < len; pc++)
+    {
+        uint32_t start = pc, end;
+        int32_t n = 0;
+
+        switch (pgm[pc])
+        {
+        case '+':
+        case '-':
+            for (; pc < len && (pgm[pc] == '+' || pgm[pc] == '-' ||
+                                !is_command(pgm[pc]));
+                 pc++)
+                n += pgm[pc] == '+' ? 1 : pgm[pc] == '-' ? -1 : 0;
+            pc--;
+            if ((uint8_t)n)
+                emit(&prog, OP_ADD, (uint8_t)n, off, start);
+            break;
+
+        case '>':
+        case '<':
+            for (; pc < len && (pgm[pc] == '>' || pgm[pc] == '<' ||
+                                !is_command(pgm[pc]));
+                 pc++)
+                n += pgm[pc] == '>' ? 1 : pgm[pc] == '<' ? -1 : 0;
+            pc--;
+            off += n;
+            break;
+
+        case '.':
+            emit(&prog, OP_OUT, 0, off, start);
+            break;
+
+        case ',':
+            emit(&prog, OP_IN, 0, off, start);
+            break;
+
+        case '[':
+            if ((end = compile_idiom(&prog, pgm, len, pc, &off)))
+                pc = end;
+            else
+            {
+                bases[sp] = off;
+                stack[sp++] = emit(&prog, OP_JZ, 0, off, start);
+            }
+            break;
+
+        case ']':
+            if (!sp)
+                panic(BRED "SYNTAX ERROR:" RES " Unmatched ']' at %u.\n", pc);
+            if (off != bases[sp - 1])
+                emit(&prog, OP_MOVE, off - bases[sp - 1], 0, start);
+            off = bases[sp - 1];
+            end = emit(&prog, OP_JNZ, 0, off, start);
+            prog.code[end].jmp = stack[--sp];
+            prog.code[stack[sp]].jmp = end;
+            break;
+        }
+    }
+
+    if (sp)
+        panic(BRED "SYNTAX ERROR:" RES " Unmatched '[' at %u.\n",
+              prog.code[stack[sp - 1]].src);
+
+    free(stack);
+    free(bases);
+    emit(&prog, OP_END, 0, 0, len);
+    return prog;
+}
+
+#endif
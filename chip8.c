@@ -5,7 +5,48 @@
  * (http://devernay.free.fr/hacks/chip8/C8TECH10.HTM).
  * @note Build with `make chip8 BUILDFLAGS="{-DDEBUG} {-DBREAKPOINTS}
  * [-lmingw32] -lSDL2main -lSDL2"`.
+ * @note Run as `./chip8 [options] rom`. Options:
+ *   --headless    run without a window, sound or keyboard, as fast as
+ *                 possible, and print the final screen at exit. The run
+ *                 ends when the ROM waits for a key or jumps to itself.
+ *   --frames=N    stop after N frames (60 per emulated second).
+ *   --scale=N     size of a CHIP-8 pixel on the host, in host pixels
+ *                 (default CELL_SIZE).
+ *   --palette=RRGGBB,RRGGBB
+ *                 colours of unlit and lit pixels (default 000000,FFFFFF).
+ *   --rects       draw lit pixels as rectangles instead of scaling a
+ *                 streaming texture.
+ *   --hz=N        instructions per second, spread evenly over the frames
+ *                 (default CPU_HZ).
+ *   --ipf=N       instructions per frame; the same as --hz=N*TARGET_FPS.
+ *   --turbo       run frames back to back instead of at TARGET_FPS. Holding
+ *                 FAST_FORWARD_KEY does the same for as long as it is down.
+ *                 Holding REWIND_KEY runs the last minutes backwards.
+ *   --load-state=FILE
+ *                 start from a snapshot instead of from boot.
+ *   --save-state=FILE
+ *                 where SAVE_STATE_KEY saves a snapshot and LOAD_STATE_KEY
+ *                 loads it back (default ROM.state). Headless runs save
+ *                 their final state there, if given.
+ *   --seed=N      seed of RND (default: the current time).
+ *   --record=FILE record the seed and every key press to a movie.
+ *   --replay=FILE replay a movie headless, as fast as possible. The ROM,
+ *                 and --load-state if any, must be those it was recorded
+ *                 with.
+ *   --dynarec     translate basic blocks to x86-64 and run them natively,
+ *                 with the interpreter as fallback (x86-64 Unix only).
+ *   --stats[=json]
+ *                 count instructions by class, frames drawn and host time
+ *                 spent per frame, and print a summary to stderr every
+ *                 STATS_INTERVAL and at exit; or, with `json`, only one
+ *                 JSON object at exit.
  */
+#define _GNU_SOURCE
+
+#if defined(__x86_64__) && defined(__unix__)
+#define DYNAREC_SUPPORTED
+#endif
+
 #define RED "\e[0;31m"
 #define BRED "\e[1;31m"
 #define GRN "\e[0;32m"
@@ -22,20 +63,24 @@
         exit(1);                                                               \
     } while (0);
 
-#define Vx (reg[(instr & 0x0F00) >> 8])
-#define Vy (reg[(instr & 0x00F0) >> 4])
-#define VF (reg[0xF])
+#define Vx (c8->state.reg[d->x])
+#define Vy (c8->state.reg[d->y])
+#define VF (c8->state.reg[0xF])
 
 #include <SDL2/SDL.h>
 #include <errno.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
-#define SCREEN_WIDTH 640
-#define SCREEN_HEIGHT 320
+#ifdef DYNAREC_SUPPORTED
+#include <sys/mman.h>
+#endif
+
 #define CELL_SIZE 10
 
 #ifndef CPU_HZ
@@ -47,7 +92,47 @@
 #endif
 
 #define TARGET_FPS 60
-#define FRAME_DELAY (1000 / TARGET_FPS)
+#define FRAME_NS (1000000000ull / TARGET_FPS)
+#define MAX_LAG_FRAMES 6
+
+#ifndef FAST_FORWARD_KEY
+#define FAST_FORWARD_KEY SDL_SCANCODE_TAB
+#endif
+
+#ifndef REWIND_BUFFER_SIZE
+#define REWIND_BUFFER_SIZE (4 << 20)
+#endif
+
+#define REWIND_KEY SDL_SCANCODE_BACKSPACE
+#define SAVE_STATE_KEY SDL_SCANCODE_F5
+#define LOAD_STATE_KEY SDL_SCANCODE_F9
+
+#define DYNAREC_CACHE_SIZE (1 << 20)
+#define DYNAREC_MAX_BLOCK 32 // instructions
+#define DYNAREC_PAGE_SIZE 64 // bytes of RAM per invalidation page
+#define DYNAREC_MAX_CODE (128 * (DYNAREC_MAX_BLOCK + 1)) // bytes per block
+#define DYNAREC_HOST_PAGE 4096
+
+#define STATS_INTERVAL (5 * 1000000000ull) // ns of host time
+
+const uint8_t FONT[80] = {
+    0xF0, 0x90, 0x90, 0x90, 0xF0, // 0
+    0x20, 0x60, 0x20, 0x20, 0x70, // 1
+    0xF0, 0x10, 0xF0, 0x80, 0xF0, // 2
+    0xF0, 0x10, 0xF0, 0x10, 0xF0, // 3
+    0x90, 0x90, 0xF0, 0x10, 0x10, // 4
+    0xF0, 0x80, 0xF0, 0x10, 0xF0, // 5
+    0xF0, 0x80, 0xF0, 0x90, 0xF0, // 6
+    0xF0, 0x10, 0x20, 0x40, 0x40, // 7
+    0xF0, 0x90, 0xF0, 0x90, 0xF0, // 8
+    0xF0, 0x90, 0xF0, 0x10, 0xF0, // 9
+    0xF0, 0x90, 0xF0, 0x90, 0x90, // A
+    0xE0, 0x90, 0xE0, 0x90, 0xE0, // B
+    0xF0, 0x80, 0x80, 0x80, 0xF0, // C
+    0xE0, 0x90, 0x90, 0x90, 0xE0, // D
+    0xF0, 0x80, 0xF0, 0x80, 0xF0, // E
+    0xF0, 0x80, 0xF0, 0x80, 0x80, // F
+};
 
 SDL_Scancode keyboard[16] = {
     SDL_SCANCODE_X, SDL_SCANCODE_1, SDL_SCANCODE_2, SDL_SCANCODE_3,
@@ -55,6 +140,101 @@ SDL_Scancode keyboard[16] = {
     SDL_SCANCODE_S, SDL_SCANCODE_D, SDL_SCANCODE_Z, SDL_SCANCODE_C,
     SDL_SCANCODE_4, SDL_SCANCODE_R, SDL_SCANCODE_F, SDL_SCANCODE_V};
 
+/**
+ * The machine talks to the host through three small backends, each a
+ * context pointer plus callbacks: where the screen goes, whether the buzzer
+ * sounds, and which keys are down.
+ */
+typedef struct __video_struct
+{
+    void *ctx;
+    void (*draw)(void *ctx, const uint64_t *screen);
+} video_t;
+
+typedef struct __audio_struct
+{
+    void *ctx;
+    void (*buzz)(void *ctx, _Bool on);
+} audio_t;
+
+typedef struct __input_struct
+{
+    void *ctx;
+    _Bool (*poll)(void *ctx);    // false once the user asked to quit
+    uint16_t (*keys)(void *ctx); // bit k is set while key k is down
+    // Sleeps until a key may be down or `ms` pass; false if none ever will.
+    _Bool (*wait)(void *ctx, uint32_t ms);
+} input_t;
+
+typedef struct __chip8_struct chip8_t;
+typedef struct __dynarec_struct dynarec_t;
+
+/**
+ * Counters gathered by `--stats`. Instructions are counted by their high
+ * nibble as they run; those an idle loop skips are only added up.
+ */
+typedef struct __stats_struct
+{
+    uint64_t ops[16];
+    uint64_t idle;
+    uint64_t frames, dirty_frames, draws;
+    uint64_t ipf_min, ipf_max; // instructions, run or skipped, per frame
+    uint64_t emulation_ns, render_ns, audio_ns;
+    uint64_t before;   // instructions counted when the frame began
+    uint32_t drawn;    // c8->drawn when the frame began
+    uint64_t reported; // when the last summary was printed
+    _Bool json;
+    _Bool headless; // nothing is ever drawn, so draws are left out
+} stats_t;
+
+/**
+ * An instruction decoded once and cached by address: the handler that runs
+ * it and its operand fields, already masked out.
+ */
+typedef struct __decoded_struct
+{
+    void (*exec)(chip8_t *c8, const struct __decoded_struct *d);
+    uint16_t nnn;
+    uint8_t x, y, n, kk;
+} decoded_t;
+
+/**
+ * Everything a ROM can observe or change, in one flat struct without
+ * pointers, so that a snapshot of the machine is a plain copy of it.
+ */
+typedef struct __state_struct
+{
+    uint64_t screen[32];
+    uint8_t ram[4096];
+    uint16_t stack[16];
+    uint32_t rng;    // xorshift32 state behind RND, never 0
+    uint32_t cycles; // instructions owed, in 1/TARGET_FPS units
+    uint16_t pc;
+    uint16_t I;
+    uint8_t reg[16];
+    uint8_t sp;
+    uint8_t dt, st;
+} state_t;
+
+struct __chip8_struct
+{
+    state_t state;
+    _Bool dirty;    // the screen changed since it was last drawn
+    uint32_t drawn; // CLS and DRW run so far, wrapping around
+    _Bool quit;
+    _Bool stuck;   // jumped to itself: only the timers can ever change now
+    uint16_t keys; // the input's keys, sampled once per frame
+    _Bool waiting; // halted on Fx0A until a key is down
+    uint32_t hz;   // instructions per second
+    video_t video;
+    audio_t audio;
+    input_t input;
+    decoded_t decoded[4096];
+    dynarec_t *dynarec; // NULL when interpreting
+    uint32_t budget;    // instructions the running dynarec blocks may run
+    stats_t *stats;     // NULL unless --stats
+};
+
 void audio_callback(void *, uint8_t *stream, int len)
 {
     int16_t *buffer = (int16_t *)stream;
@@ -73,407 +253,2102 @@ uint16_t pop(uint16_t *s, uint8_t *sp)
     return s[--(*sp)];
 }
 
-int main(int argc, char **argv)
+void dump_screen(FILE *out, const uint64_t *screen)
 {
-    if (argc < 2)
-        return 1;
+    for (uint8_t y = 0; y < 32; y++)
+    {
+        for (uint8_t x = 0; x < 64; x++)
+            fprintf(out, "%d",
+                    (uint8_t)((screen[y] & (1ll << (63 - x))) >> (63 - x)));
+        fprintf(out, "\n");
+    }
+}
 
-    uint16_t pc = 0x0200;
-    uint16_t instr;
-    uint8_t reg[16] = {0};
-    uint16_t I = 0;
-    uint8_t ram[4096] = {
-        0xF0, 0x90, 0x90, 0x90, 0xF0, // 0
-        0x20, 0x60, 0x20, 0x20, 0x70, // 1
-        0xF0, 0x10, 0xF0, 0x80, 0xF0, // 2
-        0xF0, 0x10, 0xF0, 0x10, 0xF0, // 3
-        0x90, 0x90, 0xF0, 0x10, 0x10, // 4
-        0xF0, 0x80, 0xF0, 0x10, 0xF0, // 5
-        0xF0, 0x80, 0xF0, 0x90, 0xF0, // 6
-        0xF0, 0x10, 0x20, 0x40, 0x40, // 7
-        0xF0, 0x90, 0xF0, 0x90, 0xF0, // 8
-        0xF0, 0x90, 0xF0, 0x10, 0xF0, // 9
-        0xF0, 0x90, 0xF0, 0x90, 0x90, // A
-        0xE0, 0x90, 0xE0, 0x90, 0xE0, // B
-        0xF0, 0x80, 0x80, 0x80, 0xF0, // C
-        0xE0, 0x90, 0x90, 0x90, 0xE0, // D
-        0xF0, 0x80, 0xF0, 0x80, 0xF0, // E
-        0xF0, 0x80, 0xF0, 0x80, 0x80, // F
-    };
-    uint8_t sp = 0;
-    uint16_t stack[16] = {0};
-    uint8_t dt = 0, st = 0;
-    uint64_t screen[32] = {0};
-
-    FILE *fptr = fopen(argv[1], "rb");
-    if (!fread(ram + 0x200, 1, 0x1000 - 0x200, fptr))
-        panic(RED "RUNTIME ERROR:" RES " Could not read file \"%s\".", argv[1]);
-    fclose(fptr);
+void op_decode(chip8_t *c8, const decoded_t *d);
 
-    srand(time(NULL));
+void chip8_init(chip8_t *c8)
+{
+    memset(c8, 0, sizeof(*c8));
+    memcpy(c8->state.ram, FONT, sizeof(FONT));
+    c8->state.pc = 0x0200;
+    c8->dirty = true;
+    c8->hz = CPU_HZ;
+    for (uint16_t a = 0; a < 4096; a++)
+        c8->decoded[a].exec = op_decode;
+}
 
-    SDL_Init(SDL_INIT_VIDEO);
+// Seeds RND. xorshift32 would stay at 0 forever, so 0 picks another seed.
+void chip8_seed(chip8_t *c8, uint32_t seed)
+{
+    c8->state.rng = seed ? seed : 0x9E3779B9;
+}
 
-    SDL_Window *window = SDL_CreateWindow(
-        "CHIP-8 Emulator", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
-        SCREEN_WIDTH, SCREEN_HEIGHT, 0);
+void chip8_load(chip8_t *c8, const char *path)
+{
+    FILE *fptr = fopen(path, "rb");
+    if (!fptr || !fread(c8->state.ram + 0x200, 1, 0x1000 - 0x200, fptr))
+        panic(RED "RUNTIME ERROR:" RES " Could not read file \"%s\".", path);
+    fclose(fptr);
+}
 
-    SDL_Renderer *renderer =
-        SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+#ifdef DYNAREC_SUPPORTED
+void dynarec_invalidate(dynarec_t *dr, uint16_t addr);
+#endif
 
-    SDL_Event e;
-    SDL_Rect rect;
+/**
+ * Stores a byte and drops the two cached instructions that contain it, and
+ * any block translated from it, so self-modifying code is decoded again
+ * before it runs.
+ */
+static inline void chip8_write(chip8_t *c8, uint16_t addr, uint8_t v)
+{
+    addr &= 0xFFF;
+    c8->state.ram[addr] = v;
+    c8->decoded[addr].exec = op_decode;
+    c8->decoded[(addr - 1) & 0xFFF].exec = op_decode;
+#ifdef DYNAREC_SUPPORTED
+    if (c8->dynarec)
+        dynarec_invalidate(c8->dynarec, addr);
+#endif
+}
 
-    SDL_Init(SDL_INIT_AUDIO);
+// 00E0 - CLS
+void op_cls(chip8_t *c8, const decoded_t *d)
+{
+    (void)d;
+    for (uint8_t i = 0; i < 32; i++)
+        c8->state.screen[i] = 0;
+    c8->dirty = true;
+    c8->drawn++;
+    c8->state.pc += 2;
+}
 
-    SDL_AudioSpec want, have;
-    SDL_zero(want);
-    want.freq = 44100;
-    want.format = AUDIO_S16SYS;
-    want.channels = 1;
-    want.samples = 512;
-    want.callback = audio_callback;
+// 00EE - RET
+void op_ret(chip8_t *c8, const decoded_t *d)
+{
+    (void)d;
+    c8->state.pc = pop(c8->state.stack, &c8->state.sp) + 2;
+}
 
-    SDL_AudioDeviceID dev = SDL_OpenAudioDevice(NULL, 0, &want, &have, 0);
+// 0nnn - SYS addr, and every opcode the machine does not know
+void op_nop(chip8_t *c8, const decoded_t *d)
+{
+    (void)d;
+    c8->state.pc += 2;
+}
 
-    uint32_t fs, ft;
-    const uint8_t *keyboard_state;
+// 1nnn - JP addr
+void op_jp(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.pc = d->nnn;
+}
 
-    for (;;)
-    {
-        fs = SDL_GetTicks();
+// 2nnn - CALL addr
+void op_call(chip8_t *c8, const decoded_t *d)
+{
+    if (c8->state.sp == 16)
+        panic(BRED "RUNTIME ERROR:" RES " Stack limit exceeded (16).");
+    c8->state.stack[c8->state.sp++] = c8->state.pc;
+    c8->state.pc = d->nnn;
+}
 
-        for (uint8_t in = 0; in < CPU_HZ / TARGET_FPS; in++)
-        {
-            while (SDL_PollEvent(&e))
-            {
-                if (e.type == SDL_QUIT)
-                    goto cleanup;
-            }
+// 3xkk - SE Vx, byte
+void op_se_byte(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.pc += Vx == d->kk ? 4 : 2;
+}
 
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-            SDL_RenderClear(renderer);
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+// 4xkk - SNE Vx, byte
+void op_sne_byte(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.pc += Vx != d->kk ? 4 : 2;
+}
 
-            for (uint8_t y = 0; y < 32; y++)
-            {
-                for (uint8_t x = 0; x < 64; x++)
-                {
-                    if (screen[y] & (1ll << (63 - x)))
-                    {
-                        rect = (SDL_Rect){.x = x * CELL_SIZE,
-                                          .y = y * CELL_SIZE,
-                                          .w = CELL_SIZE,
-                                          .h = CELL_SIZE};
-                        SDL_RenderFillRect(renderer, &rect);
-                    }
-                }
-            }
+// 5xy0 - SE Vx, Vy
+void op_se(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.pc += Vx == Vy ? 4 : 2;
+}
 
-            SDL_RenderPresent(renderer);
+// 6xkk - LD Vx, byte
+void op_ld_byte(chip8_t *c8, const decoded_t *d)
+{
+    Vx = d->kk;
+    c8->state.pc += 2;
+}
 
-            if (pc > 0x1000)
-                continue;
+// 7xkk - ADD Vx, byte
+void op_add_byte(chip8_t *c8, const decoded_t *d)
+{
+    Vx += d->kk;
+    c8->state.pc += 2;
+}
 
-            instr = (ram[pc] << 8) + ram[pc + 1];
+// 8xy0 - LD Vx, Vy
+void op_ld(chip8_t *c8, const decoded_t *d)
+{
+    Vx = Vy;
+    c8->state.pc += 2;
+}
 
-#ifdef DEBUG
-            printf("\n%x\n", instr);
-            for (uint8_t y = 0; y < 32; y++)
-            {
-                for (uint8_t x = 0; x < 64; x++)
-                    printf("%d", (uint8_t)((screen[y] & (1ll << (63 - x))) >>
-                                           (63 - x)));
-                printf("\n");
-            }
-#ifdef BREAKPOINTS
-            for (uint8_t i = 0; i < 16; i += 4)
-            {
-                printf("- V%x : %x", i, reg[i]);
-                printf("\t- V%x : %x", i + 1, reg[i + 1]);
-                printf("\t- V%x : %x", i + 2, reg[i + 2]);
-                printf("\t- V%x : %x\n", i + 3, reg[i + 3]);
-            }
-            printf("PC = %x\tI = %x\tDT = %x\tST = %x\n", pc, I, dt, st);
-            printf("- RAM[I] : %x", ram[I]);
-            printf("\t- RAM[I+1] : %x", ram[I + 1]);
-            printf("\t- RAM[I+2] : %x\n", ram[I + 2]);
-            getchar();
-#endif
-#endif
+// 8xy1 - OR Vx, Vy
+void op_or(chip8_t *c8, const decoded_t *d)
+{
+    Vx |= Vy;
+    c8->state.pc += 2;
+}
 
-            // 00E0 - CLS
-            if (instr == 0x00E0)
-            {
-                for (uint8_t i = 0; i < 32; i++)
-                    screen[i] = 0;
-            }
+// 8xy2 - AND Vx, Vy
+void op_and(chip8_t *c8, const decoded_t *d)
+{
+    Vx &= Vy;
+    c8->state.pc += 2;
+}
 
-            // 00EE - RET
-            else if (instr == 0x00EE)
-            {
-                pc = pop(stack, &sp) + 2;
-                continue;
-            }
+// 8xy3 - XOR Vx, Vy
+void op_xor(chip8_t *c8, const decoded_t *d)
+{
+    Vx ^= Vy;
+    c8->state.pc += 2;
+}
 
-            switch (instr & 0xF000)
-            {
-            // 0nnn - SYS addr
-            case 0:
-                break;
+// 8xy4 - ADD Vx, Vy
+void op_add(chip8_t *c8, const decoded_t *d)
+{
+    VF = Vy > (255 - Vx);
+    Vx += Vy;
+    c8->state.pc += 2;
+}
 
-            // 1nnn - JP addr
-            case 0x1000:
-                pc = instr & 0x0FFF;
-                continue;
+// 8xy5 - SUB Vx, Vy
+void op_sub(chip8_t *c8, const decoded_t *d)
+{
+    VF = Vx > Vy;
+    Vx -= Vy;
+    c8->state.pc += 2;
+}
 
-            // 2nnn - CALL addr
-            case 0x2000:
-                if (sp == 16)
-                    panic(BRED "RUNTIME ERROR:" RES
-                               " Stack limit exceeded (16).");
-                stack[sp++] = pc;
-                pc = instr & 0x0FFF;
-                continue;
+// 8xy6 - SHR Vx {, Vy}
+void op_shr(chip8_t *c8, const decoded_t *d)
+{
+    VF = Vx & 1;
+    Vx >>= 1;
+    c8->state.pc += 2;
+}
 
-            // 3xkk - SE Vx, byte
-            case 0x3000:
-                if (Vx == (instr & 0x00FF))
-                    pc += 2;
-                break;
+// 8xy7 - SUBN Vx, Vy
+void op_subn(chip8_t *c8, const decoded_t *d)
+{
+    VF = Vy > Vx;
+    Vx = Vy - Vx;
+    c8->state.pc += 2;
+}
 
-            // 4xkk - SNE Vx, byte
-            case 0x4000:
-                if (Vx != (instr & 0x00FF))
-                    pc += 2;
-                break;
+// 8xyE - SHL Vx {, Vy}
+void op_shl(chip8_t *c8, const decoded_t *d)
+{
+    VF = (Vx & 0x80 ? 1 : 0);
+    Vx <<= 1;
+    c8->state.pc += 2;
+}
 
-            // 5xy0 - SE Vx, Vy
-            case 0x5000:
-                if (Vx == Vy)
-                    pc += 2;
-                break;
+// 9xy0 - SNE Vx, Vy
+void op_sne(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.pc += Vx != Vy ? 4 : 2;
+}
 
-            // 6xkk - LD Vx, byte
-            case 0x6000:
-                Vx = (instr & 0x00FF);
-                break;
+// Annn - LD I, addr
+void op_ld_i(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.I = d->nnn;
+    c8->state.pc += 2;
+}
 
-            // 7xkk - ADD Vx, byte
-            case 0x7000:
-                Vx += (instr & 0x00FF);
-                break;
+// Bnnn - JP V0, addr
+void op_jp_v0(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.pc = d->nnn + c8->state.reg[0];
+}
 
-            case 0x8000:
-                switch (instr & 0x000F)
-                {
-                // 8xy0 - LD Vx, Vy
-                case 0:
-                    Vx = Vy;
-                    break;
-
-                // 8xy1 - OR Vx, Vy
-                case 1:
-                    Vx |= Vy;
-                    break;
-
-                // 8xy2 - AND Vx, Vy
-                case 2:
-                    Vx &= Vy;
-                    break;
-
-                // 8xy3 - XOR Vx, Vy
-                case 3:
-                    Vx ^= Vy;
-                    break;
-
-                // 8xy4 - ADD Vx, Vy
-                case 4:
-                    VF = Vy > (255 - Vx);
-                    Vx += Vy;
-                    break;
-
-                // 8xy5 - SUB Vx, Vy
-                case 5:
-                    VF = Vx > Vy;
-                    Vx -= Vy;
-                    break;
-
-                // 8xy6 - SHR Vx {, Vy}
-                case 6:
-                    VF = Vx & 1;
-                    Vx >>= 1;
-                    break;
-
-                // 8xy7 - SUBN Vx, Vy
-                case 7:
-                    VF = Vy > Vx;
-                    Vx = Vy - Vx;
-                    break;
-
-                // 8xyE - SHL Vx {, Vy}
-                case 0xE:
-                    VF = (Vx & 0x80 ? 1 : 0);
-                    Vx <<= 1;
-                    break;
-                }
-                break;
+// Cxkk - RND Vx, byte
+void op_rnd(chip8_t *c8, const decoded_t *d)
+{
+    uint32_t r = c8->state.rng;
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    c8->state.rng = r;
+    Vx = (uint8_t)r & d->kk;
+    c8->state.pc += 2;
+}
 
-            // 9xy0 - SNE Vx, Vy
-            case 0x9000:
-                if (Vx != Vy)
-                    pc += 2;
-                break;
+// Dxyn - DRW Vx, Vy, nibble
+void op_drw(chip8_t *c8, const decoded_t *d)
+{
+    VF = 0;
+    c8->dirty = true;
+    c8->drawn++;
+    uint8_t px = Vx & 0x3F, py = Vy & 0x1F;
+    uint8_t k = px + 8 - 64;
+    uint64_t b, b1, b2;
+    for (uint8_t i = 0; i < d->n; i++)
+    {
+        b = c8->state.ram[(c8->state.I + i) & 0xFFF];
+        b1 = b << (64 - 8) >> px;
+        if (px > 64 - 8)
+            b2 = (b & ((1 << k) - 1)) << (64 - k);
+        else
+            b2 = 0;
 
-            // Annn - LD I, addr
-            case 0xA000:
-                I = instr & 0x0FFF;
-                break;
+        b = b1 | b2;
 
-            // Bnnn - JP V0, addr
-            case 0xB000:
-                pc = (instr & 0x0FFF) + reg[0];
-                continue;
+        if (c8->state.screen[py] & b)
+            VF = 1;
 
-            // Cxkk - RND Vx, byte
-            case 0xC000:
-                Vx = ((uint8_t)rand()) & (instr & 0x00FF);
-                break;
+        c8->state.screen[py] ^= b;
+        py = (py + 1) & 0x1F;
+    }
+    c8->state.pc += 2;
+}
 
-            // Dxyn - DRW Vx, Vy, nibble
-            case 0xD000:
-                VF = 0;
-                uint8_t px = Vx & 0x3F, py = Vy & 0x1F;
-                uint8_t k = px + 8 - 64;
-                uint64_t b, b1, b2;
-                for (uint8_t i = 0; i < (instr & 0x000F); i++)
-                {
-                    b = ram[I + i];
-                    b1 = b << (64 - 8) >> px;
-                    if (px > 64 - 8)
-                        b2 = (b & ((1 << k) - 1)) << (64 - k);
-                    else
-                        b2 = 0;
-
-                    b = b1 | b2;
-
-                    if (screen[py] & b)
-                        VF = 1;
-
-                    screen[py] ^= b;
-                    py = (py + 1) & 0x1F;
-                }
-                break;
-            }
+// Ex9E - SKP Vx
+void op_skp(chip8_t *c8, const decoded_t *d)
+{
+    if (Vx >= 16)
+        return;
+    c8->state.pc += (c8->keys >> Vx & 1 ? 4 : 2);
+}
 
-            switch (instr & 0xF0FF)
-            {
-            // Ex9E - SKP Vx
-            case 0xE09E:
-                if (Vx >= 16)
-                    continue;
-                keyboard_state = SDL_GetKeyboardState(NULL);
-                pc += (keyboard_state[keyboard[Vx]] ? 2 : 0);
-                break;
+// ExA1 - SKNP Vx
+void op_sknp(chip8_t *c8, const decoded_t *d)
+{
+    if (Vx >= 16)
+    {
+        c8->state.pc += 4;
+        return;
+    }
+    c8->state.pc += (c8->keys >> Vx & 1 ? 2 : 4);
+}
 
-            // ExA1 - SKNP Vx
-            case 0xE0A1:
-                if (Vx >= 16)
-                {
-                    pc += 4;
-                    continue;
-                }
-                keyboard_state = SDL_GetKeyboardState(NULL);
-                pc += (keyboard_state[keyboard[Vx]] ? 0 : 2);
-                break;
+// Fx07 - LD Vx, DT
+void op_ld_vx_dt(chip8_t *c8, const decoded_t *d)
+{
+    Vx = c8->state.dt;
+    c8->state.pc += 2;
+}
 
-            // Fx07 - LD Vx, DT
-            case 0xF007:
-                Vx = dt;
-                break;
+// Fx0A - LD Vx, K
+void op_ld_k(chip8_t *c8, const decoded_t *d)
+{
+    uint8_t key = 0;
 
-            // Fx0A - LD Vx, K
-            case 0xF00A:
-                while (1)
-                {
-                    SDL_PumpEvents();
-                    keyboard_state = SDL_GetKeyboardState(NULL);
-                    for (uint8_t i = 0; i < 16; i++)
-                    {
-                        if (keyboard_state[keyboard[i]])
-                        {
-                            Vx = i;
-                            goto finish_fetching;
-                        }
-                    }
-                }
-            finish_fetching:
-                break;
+    // Halt for the rest of the frame, and run again once keys are sampled.
+    if (!c8->keys)
+    {
+        c8->waiting = true;
+        return;
+    }
 
-            // Fx15 - LD DT, Vx
-            case 0xF015:
-                dt = Vx;
-                break;
+    while (!(c8->keys >> key & 1))
+        key++;
+    Vx = key;
+    c8->state.pc += 2;
+}
 
-            // Fx18 - LD ST, Vx
-            case 0xF018:
-                st = Vx;
-                break;
+// Fx15 - LD DT, Vx
+void op_ld_dt(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.dt = Vx;
+    c8->state.pc += 2;
+}
 
-            // Fx1E - ADD I, Vx
-            case 0xF01E:
-                I += Vx;
-                break;
+// Fx18 - LD ST, Vx
+void op_ld_st(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.st = Vx;
+    c8->state.pc += 2;
+}
 
-            // Fx29 - LD F, Vx
-            case 0xF029:
-                I = 5 * (Vx & 0xF);
-                break;
+// Fx1E - ADD I, Vx
+void op_add_i(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.I += Vx;
+    c8->state.pc += 2;
+}
 
-            // Fx33 - LD B, Vx
-            case 0xF033:
-                ram[I] = Vx / 100;
-                ram[I + 1] = (Vx / 10) % 10;
-                ram[I + 2] = Vx % 10;
-                break;
+// Fx29 - LD F, Vx
+void op_ld_f(chip8_t *c8, const decoded_t *d)
+{
+    c8->state.I = 5 * (Vx & 0xF);
+    c8->state.pc += 2;
+}
 
-            // Fx55 - LD [I], Vx
-            case 0xF055:
-                for (uint8_t i = 0; i <= ((instr & 0x0F00) >> 8); i++)
-                    ram[I + i] = reg[i];
-                break;
+// Fx33 - LD B, Vx
+void op_ld_b(chip8_t *c8, const decoded_t *d)
+{
+    uint8_t v = Vx;
+    chip8_write(c8, c8->state.I, v / 100);
+    chip8_write(c8, c8->state.I + 1, (v / 10) % 10);
+    chip8_write(c8, c8->state.I + 2, v % 10);
+    c8->state.pc += 2;
+}
 
-            // Fx65 - LD Vx, [I]
-            case 0xF065:
-                for (uint8_t i = 0; i <= ((instr & 0x0F00) >> 8); i++)
-                    reg[i] = ram[I + i];
-                break;
-            }
+// Fx55 - LD [I], Vx
+void op_ld_mem(chip8_t *c8, const decoded_t *d)
+{
+    for (uint8_t i = 0; i <= d->x; i++)
+        chip8_write(c8, c8->state.I + i, c8->state.reg[i]);
+    c8->state.pc += 2;
+}
+
+// Fx65 - LD Vx, [I]
+void op_ld_regs(chip8_t *c8, const decoded_t *d)
+{
+    for (uint8_t i = 0; i <= d->x; i++)
+        c8->state.reg[i] = c8->state.ram[(c8->state.I + i) & 0xFFF];
+    c8->state.pc += 2;
+}
 
-            pc += 2;
+/**
+ * Picks the handler for an opcode. This is the only place that looks at
+ * the raw opcode; everything else runs from the decoded entry.
+ */
+decoded_t decode(uint16_t instr)
+{
+    decoded_t d = {.exec = op_nop,
+                   .nnn = instr & 0x0FFF,
+                   .x = (instr & 0x0F00) >> 8,
+                   .y = (instr & 0x00F0) >> 4,
+                   .n = instr & 0x000F,
+                   .kk = instr & 0x00FF};
+
+    static void (*const alu[16])(chip8_t *, const decoded_t *) = {
+        op_ld,  op_or,  op_and, op_xor, op_add, op_sub, op_shr, op_subn,
+        op_nop, op_nop, op_nop, op_nop, op_nop, op_nop, op_shl, op_nop};
+    static void (*const ops[16])(chip8_t *, const decoded_t *) = {
+        op_nop,     op_jp,       op_call, op_se_byte, op_sne_byte, op_se,
+        op_ld_byte, op_add_byte, op_nop,  op_sne,     op_ld_i,     op_jp_v0,
+        op_rnd,     op_drw,      op_nop,  op_nop};
+
+    if (instr == 0x00E0)
+        d.exec = op_cls;
+    else if (instr == 0x00EE)
+        d.exec = op_ret;
+    else if ((instr & 0xF000) == 0x8000)
+        d.exec = alu[d.n];
+    else if ((instr & 0xF000) < 0xE000)
+        d.exec = ops[instr >> 12];
+    else
+    {
+        switch (instr & 0xF0FF)
+        {
+        case 0xE09E:
+            d.exec = op_skp;
+            break;
+        case 0xE0A1:
+            d.exec = op_sknp;
+            break;
+        case 0xF007:
+            d.exec = op_ld_vx_dt;
+            break;
+        case 0xF00A:
+            d.exec = op_ld_k;
+            break;
+        case 0xF015:
+            d.exec = op_ld_dt;
+            break;
+        case 0xF018:
+            d.exec = op_ld_st;
+            break;
+        case 0xF01E:
+            d.exec = op_add_i;
+            break;
+        case 0xF029:
+            d.exec = op_ld_f;
+            break;
+        case 0xF033:
+            d.exec = op_ld_b;
+            break;
+        case 0xF055:
+            d.exec = op_ld_mem;
+            break;
+        case 0xF065:
+            d.exec = op_ld_regs;
+            break;
         }
+    }
+
+    return d;
+}
+
+// The handler of every address not decoded yet (or written since).
+void op_decode(chip8_t *c8, const decoded_t *d)
+{
+    const uint8_t *ram = c8->state.ram;
+    uint16_t pc = c8->state.pc;
+    decoded_t *entry = c8->decoded + pc;
+    *entry = decode((ram[pc] << 8) + ram[(pc + 1) & 0xFFF]);
+    (void)d;
+    entry->exec(c8, entry);
+}
+
+/**
+ * Recognizes, with pc at its head, a loop that can only end once the timers
+ * tick: a jump to itself (1), or `ld Vx, DT; se Vx, 0; jp` polling the
+ * delay timer (2), which only idles while the timer runs. Anything else
+ * is 0.
+ */
+int chip8_idle_loop(const chip8_t *c8, uint16_t pc)
+{
+    const uint8_t *op = c8->state.ram + pc;
+
+    if (pc <= 0xFFE && ((op[0] << 8) | op[1]) == (0x1000 | pc))
+        return 1;
+    if (pc > 0xFFA || (op[0] & 0xF0) != 0xF0 || op[1] != 0x07 ||
+        op[2] != (0x30 | (op[0] & 0x0F)) || op[3] != 0x00 ||
+        ((op[4] << 8) | op[5]) != (0x1000 | pc))
+        return 0;
+    return 2;
+}
 
-        ft = SDL_GetTicks() - fs;
-        if (ft < FRAME_DELAY)
-            SDL_Delay(FRAME_DELAY - ft);
+/**
+ * Skips an idle loop at pc. The timers tick only at the end of the frame,
+ * so the `n` instructions left in it are skipped, leaving the machine
+ * exactly as running them would have. Returns true if it did so.
+ */
+_Bool chip8_skip_idle(chip8_t *c8, uint32_t n)
+{
+    int loop = chip8_idle_loop(c8, c8->state.pc);
+
+    if (loop == 1)
+        c8->stuck = true;
+    else if (loop != 2 || !c8->state.dt)
+        return false;
+    else
+    {
+        const uint8_t *op = c8->state.ram + c8->state.pc;
+        c8->state.reg[op[0] & 0x0F] = c8->state.dt;
+        c8->state.pc += 2 * (n % 3);
+    }
+
+    if (c8->stats)
+        c8->stats->idle += n;
+    return true;
+}
 
-        if (dt)
-            dt--;
+/**
+ * Executes `n` instructions, or fewer if the run ends on the way. Each one
+ * is a single indirect call through the decode cache.
+ */
+void chip8_step(chip8_t *c8, uint32_t n)
+{
+    stats_t *stats = c8->stats;
+
+    for (; n && !c8->quit && !c8->waiting; n--)
+    {
+        if (c8->state.pc >= 0x1000)
+            continue;
 
-        if (st)
+#ifdef DEBUG
+        printf("\n%x\n", (c8->state.ram[c8->state.pc] << 8) +
+                             c8->state.ram[(c8->state.pc + 1) & 0xFFF]);
+        dump_screen(stdout, c8->state.screen);
+#ifdef BREAKPOINTS
+        for (uint8_t i = 0; i < 16; i += 4)
         {
-            SDL_PauseAudioDevice(dev, 0);
-            st--;
+            printf("- V%x : %x", i, c8->state.reg[i]);
+            printf("\t- V%x : %x", i + 1, c8->state.reg[i + 1]);
+            printf("\t- V%x : %x", i + 2, c8->state.reg[i + 2]);
+            printf("\t- V%x : %x\n", i + 3, c8->state.reg[i + 3]);
         }
-        else
-            SDL_PauseAudioDevice(dev, 1);
+        printf("PC = %x\tI = %x\tDT = %x\tST = %x\n", c8->state.pc,
+               c8->state.I, c8->state.dt, c8->state.st);
+        printf("- RAM[I] : %x", c8->state.ram[c8->state.I]);
+        printf("\t- RAM[I+1] : %x", c8->state.ram[c8->state.I + 1]);
+        printf("\t- RAM[I+2] : %x\n", c8->state.ram[c8->state.I + 2]);
+        getchar();
+#endif
+#endif
+
+        const decoded_t *d = c8->decoded + c8->state.pc;
+        if ((d->exec == op_jp || d->exec == op_ld_vx_dt) &&
+            chip8_skip_idle(c8, n))
+            break;
+        if (stats)
+            stats->ops[c8->state.ram[c8->state.pc] >> 4]++;
+        d->exec(c8, d);
     }
+}
 
-cleanup:
-    SDL_CloseAudioDevice(dev);
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
-    SDL_Quit();
+#ifdef DYNAREC_SUPPORTED
+#define FIELD(f) offsetof(chip8_t, state.f)
+#define FIELD_V(x) (offsetof(chip8_t, state.reg) + (x))
 
-    return 0;
-}
\ No newline at end of file
+/**
+ * A translated basic block: native code that runs the instructions from
+ * its address on, `count` of them at most, and leaves `pc` at the next one
+ * to run.
+ */
+typedef struct __block_struct
+{
+    void (*run)(chip8_t *c8);
+    uint16_t end; // one past the last byte of RAM it was translated from
+    uint8_t count;
+    _Bool idle; // starts an idle loop, left to chip8_skip_idle
+} block_t;
+
+// A skip in the block being translated that goes on further into it.
+typedef struct __dynarec_jump_struct
+{
+    uint32_t at; // where its rel32 is in the code
+    uint16_t to;
+} dynarec_jump_t;
+
+struct __dynarec_struct
+{
+    uint8_t *code; // DYNAREC_CACHE_SIZE bytes, executable
+    size_t len;
+    uint64_t pages; // bit p is set while page p may hold translated code
+    block_t blocks[4096];
+    void *links[4096]; // where a block going on to an address jumps, or NULL
+    // Patched once the block being translated is complete.
+    dynarec_jump_t jumps[DYNAREC_MAX_BLOCK];
+    uint32_t refunds[DYNAREC_MAX_BLOCK]; // where budget is given back
+    uint8_t njumps, nrefunds;
+};
+
+void dynarec_bytes(dynarec_t *dr, const uint8_t *bytes, size_t n)
+{
+    memcpy(dr->code + dr->len, bytes, n);
+    dr->len += n;
+}
+
+void dynarec_word(dynarec_t *dr, uint16_t v)
+{
+    dynarec_bytes(dr, (const uint8_t *)&v, 2);
+}
+
+void dynarec_dword(dynarec_t *dr, uint32_t v)
+{
+    dynarec_bytes(dr, (const uint8_t *)&v, 4);
+}
+
+void dynarec_patch(dynarec_t *dr, size_t at, uint32_t v)
+{
+    memcpy(dr->code + at, &v, 4);
+}
+
+// `opcode` with a ModRM for `[rbx + off]` and `reg` in the reg field.
+void dynarec_op(dynarec_t *dr, uint8_t opcode, uint8_t reg, size_t off)
+{
+    dr->code[dr->len++] = opcode;
+    dr->code[dr->len++] = 0x80 | (reg << 3) | 3;
+    dynarec_dword(dr, off);
+}
+
+void dynarec_set_pc(dynarec_t *dr, uint16_t addr)
+{
+    dr->code[dr->len++] = 0x66; // mov word [rbx + pc], addr
+    dynarec_op(dr, 0xC7, 0, FIELD(pc));
+    dynarec_word(dr, addr);
+}
+
+/**
+ * add/sub/cmp dword [rbx + budget], n as `reg` is 0, 5 or 7. Returns where
+ * n is, to patch it.
+ */
+size_t dynarec_budget(dynarec_t *dr, uint8_t reg, uint32_t n)
+{
+    dynarec_op(dr, 0x81, reg, offsetof(chip8_t, budget));
+    dynarec_dword(dr, n);
+    return dr->len - 4;
+}
+
+/**
+ * Goes on at `addr`: jumps into the block translated from there, if there
+ * is one, or returns to dynarec_step. Blocks are looked up in `links` as
+ * they are left, so none is ever patched once translated.
+ */
+void dynarec_link(dynarec_t *dr, uint16_t addr)
+{
+    dynarec_set_pc(dr, addr);
+    if (addr < 0x1000)
+    {
+        void **link = dr->links + addr;
+        dynarec_bytes(dr, (const uint8_t[]){0x48, 0xB8}, 2); // mov rax, link
+        dynarec_bytes(dr, (const uint8_t *)&link, 8);
+        // mov rax, [rax]; test rax, rax; jz +2; jmp rax
+        dynarec_bytes(dr,
+                      (const uint8_t[]){0x48, 0x8B, 0x00, 0x48, 0x85, 0xC0,
+                                        0x74, 0x02, 0xFF, 0xE0},
+                      10);
+    }
+    dynarec_bytes(dr, (const uint8_t[]){0x5B, 0xC3}, 2); // pop rbx; ret
+}
+
+// Like dynarec_link, to wherever the instruction just run left `pc`.
+void dynarec_link_pc(dynarec_t *dr)
+{
+    void **links = dr->links;
+    dr->code[dr->len++] = 0x0F; // movzx eax, word [rbx + pc]
+    dynarec_op(dr, 0xB7, 0, FIELD(pc));
+    // cmp eax, 0xFFF; ja +21; mov rcx, links
+    dynarec_bytes(dr,
+                  (const uint8_t[]){0x3D, 0xFF, 0x0F, 0x00, 0x00, 0x77, 21,
+                                    0x48, 0xB9},
+                  9);
+    dynarec_bytes(dr, (const uint8_t *)&links, 8);
+    // mov rax, [rcx + 8 * rax]; test rax, rax; jz +2; jmp rax; pop rbx; ret
+    dynarec_bytes(dr,
+                  (const uint8_t[]){0x48, 0x8B, 0x04, 0xC1, 0x48, 0x85, 0xC0,
+                                    0x74, 0x02, 0xFF, 0xE0, 0x5B, 0xC3},
+                  13);
+}
+
+// Points the skips that go on at `addr` to the code emitted next.
+void dynarec_land(dynarec_t *dr, uint16_t addr)
+{
+    for (uint8_t i = 0; i < dr->njumps; i++)
+        if (dr->jumps[i].to == addr)
+            dynarec_patch(dr, dr->jumps[i].at,
+                          dr->len - dr->jumps[i].at - 4);
+}
+
+// Whether a block ends with the instruction: it goes elsewhere, may wait
+// for a key, or writes RAM, maybe the block's own.
+_Bool dynarec_ends(const decoded_t *d)
+{
+    return d->exec == op_jp || d->exec == op_call || d->exec == op_ret ||
+           d->exec == op_jp_v0 || d->exec == op_ld_k || d->exec == op_ld_b ||
+           d->exec == op_ld_mem;
+}
+
+/**
+ * Follows a compare: unless `jcc` (a short conditional jump opcode) says
+ * the instruction at `addr` does not skip, goes on at `addr + 4`. That is
+ * further into the block unless the block ends first, and the skipped
+ * instruction, if the block has it, is given back to the budget.
+ */
+void dynarec_skip(dynarec_t *dr, const chip8_t *c8, uint16_t addr,
+                  uint8_t jcc, _Bool last)
+{
+    const uint8_t *ram = c8->state.ram;
+    size_t at = dr->len;
+    dynarec_bytes(dr, (const uint8_t[]){jcc, 0}, 2);
+
+    _Bool within = false;
+    if (!last)
+    {
+        dynarec_budget(dr, 0, 1);
+        decoded_t next = decode((ram[addr + 2] << 8) + ram[addr + 3]);
+        within = !dynarec_ends(&next);
+    }
+    if (within)
+    {
+        dr->code[dr->len++] = 0xE9; // jmp rel32
+        dr->jumps[dr->njumps++] = (dynarec_jump_t){dr->len, addr + 4};
+        dynarec_dword(dr, 0);
+    }
+    else
+        dynarec_link(dr, addr + 4);
+
+    dr->code[at + 1] = dr->len - at - 2;
+}
+
+/**
+ * Emits the instruction at `addr`, the next one of block `b`. Register
+ * arithmetic, loads of I and the timers, jumps and skips become inline
+ * x86-64 that works on the machine through rbx; everything else calls its
+ * handler with its entry in the decode cache, which is filled here. With
+ * `--stats` each instruction also counts itself. Returns dynarec_ends.
+ */
+_Bool dynarec_translate(dynarec_t *dr, chip8_t *c8, const block_t *b,
+                        uint16_t addr)
+{
+    const uint8_t *ram = c8->state.ram;
+    decoded_t d = decode((ram[addr] << 8) + ram[addr + 1]);
+    size_t vx = FIELD_V(d.x), vy = FIELD_V(d.y), vf = FIELD_V(0xF);
+    _Bool last = b->count + 1 == DYNAREC_MAX_BLOCK || addr + 2 >= 0xFFF;
+
+    c8->decoded[addr] = d;
+    if (c8->stats)
+    {
+        uint64_t *op = c8->stats->ops + (ram[addr] >> 4);
+        dynarec_bytes(dr, (const uint8_t[]){0x48, 0xB8}, 2); // mov rax, op
+        dynarec_bytes(dr, (const uint8_t *)&op, 8);
+        dynarec_bytes(dr, (const uint8_t[]){0x48, 0xFF, 0x00}, 3); // inc
+    }
+
+    if (d.exec == op_nop)
+        return false;
+
+    if (d.exec == op_ld_byte || d.exec == op_add_byte)
+    {
+        // mov/add byte [rbx + Vx], kk
+        dynarec_op(dr, d.exec == op_ld_byte ? 0xC6 : 0x80, 0, vx);
+        dr->code[dr->len++] = d.kk;
+    }
+    else if (d.exec == op_ld || d.exec == op_or || d.exec == op_and ||
+             d.exec == op_xor)
+    {
+        dynarec_op(dr, 0x8A, 0, vy); // mov al, Vy
+        dynarec_op(dr,
+                   d.exec == op_ld    ? 0x88
+                   : d.exec == op_or  ? 0x08
+                   : d.exec == op_and ? 0x20
+                                      : 0x30,
+                   0, vx); // mov/or/and/xor Vx, al
+    }
+    else if (d.exec == op_add || d.exec == op_sub)
+    {
+        // VF is set first and Vx updated after, reading VF anew, exactly
+        // in the interpreter's order.
+        dynarec_op(dr, 0x8A, 0, vx); // mov al, Vx
+        if (d.exec == op_add)
+        {
+            dynarec_op(dr, 0x02, 0, vy); // add al, Vy
+            dynarec_bytes(dr, (const uint8_t[]){0x0F, 0x92, 0xC1}, 3);
+        }
+        else
+        {
+            dynarec_op(dr, 0x3A, 0, vy); // cmp al, Vy
+            dynarec_bytes(dr, (const uint8_t[]){0x0F, 0x97, 0xC1}, 3);
+        }
+        dynarec_op(dr, 0x88, 1, vf); // mov VF, cl (setc cl / seta cl)
+        dynarec_op(dr, 0x8A, 0, vy); // mov al, Vy
+        dynarec_op(dr, d.exec == op_add ? 0x00 : 0x28, 0, vx); // add/sub
+    }
+    else if (d.exec == op_subn)
+    {
+        dynarec_op(dr, 0x8A, 0, vy); // mov al, Vy
+        dynarec_op(dr, 0x3A, 0, vx); // cmp al, Vx
+        dynarec_bytes(dr, (const uint8_t[]){0x0F, 0x97, 0xC1}, 3);
+        dynarec_op(dr, 0x88, 1, vf); // seta cl; mov VF, cl
+        dynarec_op(dr, 0x8A, 0, vy); // mov al, Vy
+        dynarec_op(dr, 0x2A, 0, vx); // sub al, Vx
+        dynarec_op(dr, 0x88, 0, vx); // mov Vx, al
+    }
+    else if (d.exec == op_shr || d.exec == op_shl)
+    {
+        dynarec_op(dr, 0x8A, 0, vx); // mov al, Vx
+        if (d.exec == op_shr)
+            dynarec_bytes(dr, (const uint8_t[]){0x24, 0x01}, 2); // and al, 1
+        else
+            dynarec_bytes(dr, (const uint8_t[]){0xC0, 0xE8, 0x07}, 3);
+        dynarec_op(dr, 0x88, 0, vf); // mov VF, al
+        dynarec_op(dr, 0xD0, d.exec == op_shr ? 5 : 4, vx); // shr/shl Vx, 1
+    }
+    else if (d.exec == op_ld_i)
+    {
+        dr->code[dr->len++] = 0x66; // mov word [rbx + I], nnn
+        dynarec_op(dr, 0xC7, 0, FIELD(I));
+        dynarec_word(dr, d.nnn);
+    }
+    else if (d.exec == op_ld_vx_dt)
+    {
+        dynarec_op(dr, 0x8A, 0, FIELD(dt)); // mov al, DT
+        dynarec_op(dr, 0x88, 0, vx);        // mov Vx, al
+    }
+    else if (d.exec == op_ld_dt || d.exec == op_ld_st)
+    {
+        dynarec_op(dr, 0x8A, 0, vx); // mov al, Vx; mov DT/ST, al
+        dynarec_op(dr, 0x88, 0, d.exec == op_ld_dt ? FIELD(dt) : FIELD(st));
+    }
+    else if (d.exec == op_add_i || d.exec == op_ld_f)
+    {
+        dr->code[dr->len++] = 0x0F; // movzx eax, Vx
+        dynarec_op(dr, 0xB6, 0, vx);
+        if (d.exec == op_ld_f) // and eax, 15; lea eax, [rax + 4 * rax]
+            dynarec_bytes(dr, (const uint8_t[]){0x83, 0xE0, 0x0F, 0x8D, 0x04,
+                                                0x80},
+                          6);
+        dr->code[dr->len++] = 0x66; // add/mov word [rbx + I], ax
+        dynarec_op(dr, d.exec == op_add_i ? 0x01 : 0x89, 0, FIELD(I));
+    }
+    else if (d.exec == op_jp)
+    {
+        dynarec_link(dr, d.nnn);
+        return true;
+    }
+    else if (d.exec == op_se_byte || d.exec == op_sne_byte)
+    {
+        dynarec_op(dr, 0x80, 7, vx); // cmp byte Vx, kk
+        dr->code[dr->len++] = d.kk;
+        dynarec_skip(dr, c8, addr, d.exec == op_se_byte ? 0x75 : 0x74, last);
+    }
+    else if (d.exec == op_se || d.exec == op_sne)
+    {
+        dynarec_op(dr, 0x8A, 0, vx); // mov al, Vx; cmp al, Vy
+        dynarec_op(dr, 0x3A, 0, vy);
+        dynarec_skip(dr, c8, addr, d.exec == op_se ? 0x75 : 0x74, last);
+    }
+    else if (d.exec == op_skp || d.exec == op_sknp)
+    {
+        dr->code[dr->len++] = 0x0F; // movzx eax, Vx
+        dynarec_op(dr, 0xB6, 0, vx);
+        dr->code[dr->len++] = 0x0F; // movzx ecx, word [rbx + keys]
+        dynarec_op(dr, 0xB7, 1, offsetof(chip8_t, keys));
+        dynarec_bytes(dr, (const uint8_t[]){0x83, 0xF8, 0x10}, 3); // cmp 16
+        if (d.exec == op_skp)
+        {
+            // SKP of a key past F runs again and again: the rest of the
+            // block is given back, to be patched in once its size is known.
+            size_t at = dr->len;
+            dynarec_bytes(dr, (const uint8_t[]){0x72, 0}, 2); // jb
+            dr->refunds[dr->nrefunds++] = dynarec_budget(dr, 0, b->count + 1);
+            dynarec_link(dr, addr);
+            dr->code[at + 1] = dr->len - at - 2;
+            // bt ecx, eax; the key is in CF
+            dynarec_bytes(dr, (const uint8_t[]){0x0F, 0xA3, 0xC1}, 3);
+            dynarec_skip(dr, c8, addr, 0x73, last); // jnc
+        }
+        else
+        {
+            // A key past F is never down: sbb edx, edx; and ecx, edx;
+            // bt ecx, eax
+            dynarec_bytes(dr,
+                          (const uint8_t[]){0x19, 0xD2, 0x21, 0xD1, 0x0F,
+                                            0xA3, 0xC1},
+                          7);
+            dynarec_skip(dr, c8, addr, 0x72, last); // jc
+        }
+    }
+    else
+    {
+        // pc = addr; d.exec(rbx, &rbx->decoded[addr])
+        dynarec_set_pc(dr, addr);
+        // mov rdi, rbx; lea rsi, [rbx + entry]; mov rax, d.exec; call rax
+        dynarec_bytes(dr, (const uint8_t[]){0x48, 0x89, 0xDF, 0x48, 0x8D, 0xB3},
+                      6);
+        dynarec_dword(dr, offsetof(chip8_t, decoded) + addr * sizeof(d));
+        dynarec_bytes(dr, (const uint8_t[]){0x48, 0xB8}, 2);
+        dynarec_bytes(dr, (const uint8_t *)&d.exec, 8);
+        dynarec_bytes(dr, (const uint8_t[]){0xFF, 0xD0}, 2);
+
+        if (d.exec == op_ld_k) // may wait: pop rbx; ret
+            dynarec_bytes(dr, (const uint8_t[]){0x5B, 0xC3}, 2);
+        else if (d.exec == op_call)
+            dynarec_link(dr, d.nnn);
+        else if (d.exec == op_ld_b || d.exec == op_ld_mem)
+            dynarec_link(dr, addr + 2);
+        else if (dynarec_ends(&d))
+            dynarec_link_pc(dr);
+    }
+
+    return dynarec_ends(&d);
+}
+
+// Forgets every translated block and reclaims the whole cache.
+void dynarec_flush(dynarec_t *dr)
+{
+    memset(dr->blocks, 0, sizeof(dr->blocks));
+    memset(dr->links, 0, sizeof(dr->links));
+    dr->pages = 0;
+    dr->len = 0;
+}
+
+/**
+ * Translates the basic block at `addr` into a `void (chip8_t *)` function
+ * that keeps the machine in rbx. The block ends after the first
+ * instruction that leaves straight-line code, after DYNAREC_MAX_BLOCK
+ * instructions or at the end of RAM; skips within it stay in it. Its body
+ * takes the instructions it may run out of c8->budget, or returns if that
+ * is too few. A full cache is simply flushed.
+ */
+void dynarec_compile(dynarec_t *dr, chip8_t *c8, uint16_t addr)
+{
+    if (dr->len + DYNAREC_MAX_CODE > DYNAREC_CACHE_SIZE)
+        dynarec_flush(dr);
+
+    // Only the host pages the block can land on are made writable.
+    size_t from = dr->len & ~(size_t)(DYNAREC_HOST_PAGE - 1);
+    size_t to = (dr->len + DYNAREC_MAX_CODE + DYNAREC_HOST_PAGE - 1) &
+                ~(size_t)(DYNAREC_HOST_PAGE - 1);
+    if (to > DYNAREC_CACHE_SIZE)
+        to = DYNAREC_CACHE_SIZE;
+    if (mprotect(dr->code + from, to - from, PROT_READ | PROT_WRITE))
+        panic(BRED "RUNTIME ERROR:" RES " Could not map dynarec code.");
+
+    block_t *b = dr->blocks + addr;
+    b->run = (void (*)(chip8_t *))(dr->code + dr->len);
+    b->count = 0;
+    b->idle = chip8_idle_loop(c8, addr);
+    dr->njumps = dr->nrefunds = 0;
+
+    // push rbx; mov rbx, rdi
+    dynarec_bytes(dr, (const uint8_t[]){0x53, 0x48, 0x89, 0xFB}, 4);
+
+    // The body: cmp budget, count; jae +2; pop rbx; ret; sub budget, count
+    uint8_t *body = dr->code + dr->len;
+    size_t check = dynarec_budget(dr, 7, 0);
+    dynarec_bytes(dr, (const uint8_t[]){0x73, 0x02, 0x5B, 0xC3}, 4);
+    size_t charge = dynarec_budget(dr, 5, 0);
+
+    uint16_t pc = addr;
+    _Bool ends = false;
+    while (!ends && b->count < DYNAREC_MAX_BLOCK && pc < 0xFFF)
+    {
+        dynarec_land(dr, pc);
+        ends = dynarec_translate(dr, c8, b, pc);
+        pc += 2;
+        b->count++;
+    }
+    if (!ends)
+    {
+        dynarec_land(dr, pc);
+        dynarec_link(dr, pc);
+    }
+
+    dynarec_patch(dr, check, b->count);
+    dynarec_patch(dr, charge, b->count);
+    for (uint8_t i = 0; i < dr->nrefunds; i++)
+    {
+        uint32_t run;
+        memcpy(&run, dr->code + dr->refunds[i], 4);
+        dynarec_patch(dr, dr->refunds[i], b->count - run);
+    }
+
+    b->end = pc;
+    dr->links[addr] = b->idle ? NULL : body;
+    for (uint16_t p = addr / DYNAREC_PAGE_SIZE;
+         p <= (pc - 1) / DYNAREC_PAGE_SIZE; p++)
+        dr->pages |= 1ull << p;
+
+    if (mprotect(dr->code + from, to - from, PROT_READ | PROT_EXEC))
+        panic(BRED "RUNTIME ERROR:" RES " Could not map dynarec code.");
+}
+
+/**
+ * Forgets every block translated from the byte at `addr`. Data that merely
+ * shares a page with code can then be written without recompiling the
+ * code. No block spans more than 2 * DYNAREC_MAX_BLOCK bytes, so only the
+ * blocks starting shortly before `addr` need to be looked at.
+ */
+void dynarec_invalidate(dynarec_t *dr, uint16_t addr)
+{
+    if (!(dr->pages & (1ull << (addr / DYNAREC_PAGE_SIZE))))
+        return;
+
+    int32_t a = addr - 2 * DYNAREC_MAX_BLOCK + 1;
+    for (a = a < 0 ? 0 : a; a <= addr; a++)
+        if (dr->blocks[a].run && dr->blocks[a].end > addr)
+        {
+            dr->blocks[a].run = NULL;
+            dr->links[a] = NULL;
+        }
+}
+
+/**
+ * Executes `n` instructions like chip8_step, a block at a time. Blocks go
+ * on into each other while what is left of `n`, in c8->budget, covers the
+ * next one whole. The interpreter takes over one instruction at a time
+ * where it does not, and where no block can be translated (the last byte
+ * of RAM), so instruction counts, and with them the timers, stay exactly
+ * as they are when interpreting.
+ */
+void dynarec_step(chip8_t *c8, uint32_t n)
+{
+    dynarec_t *dr = c8->dynarec;
+
+    while (n && !c8->quit && !c8->waiting && c8->state.pc < 0x1000)
+    {
+        block_t *b = dr->blocks + c8->state.pc;
+        if (!b->run && c8->state.pc < 0xFFF)
+            dynarec_compile(dr, c8, c8->state.pc);
+
+        if (b->run && b->idle && chip8_skip_idle(c8, n))
+            break;
+        if (b->run && b->count <= n)
+        {
+            c8->budget = n;
+            b->run(c8);
+            n = c8->budget;
+        }
+        else
+        {
+            chip8_step(c8, 1);
+            n--;
+        }
+    }
+}
+
+void dynarec_attach(dynarec_t *dr, chip8_t *c8)
+{
+    dr->code = mmap(NULL, DYNAREC_CACHE_SIZE, PROT_READ | PROT_EXEC,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (dr->code == MAP_FAILED)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.");
+    c8->dynarec = dr;
+}
+
+void dynarec_detach(dynarec_t *dr)
+{
+    munmap(dr->code, DYNAREC_CACHE_SIZE);
+}
+#endif
+
+// Nanoseconds on a monotonic host clock.
+uint64_t clock_ns(void)
+{
+#ifdef __unix__
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#else
+    uint64_t hz = SDL_GetPerformanceFrequency();
+    uint64_t t = SDL_GetPerformanceCounter();
+    return t / hz * 1000000000ull + t % hz * 1000000000ull / hz;
+#endif
+}
+
+const char *const OP_CLASSES[16] = {
+    "0nnn cls/ret", "1nnn jp",    "2nnn call", "3xkk se",
+    "4xkk sne",     "5xy0 se",    "6xkk ld",   "7xkk add",
+    "8xyn alu",     "9xy0 sne",   "Annn ld I", "Bnnn jp V0",
+    "Cxkk rnd",     "Dxyn drw",   "Exkk skp",  "Fxkk misc"};
+
+void stats_init(stats_t *s, _Bool json, _Bool headless)
+{
+    memset(s, 0, sizeof(*s));
+    s->ipf_min = UINT64_MAX;
+    s->json = json;
+    s->headless = headless;
+    s->reported = clock_ns();
+}
+
+uint64_t stats_instructions(const stats_t *s)
+{
+    uint64_t n = s->idle;
+    for (uint8_t i = 0; i < 16; i++)
+        n += s->ops[i];
+    return n;
+}
+
+void stats_print(const stats_t *s, FILE *out)
+{
+    uint64_t n = stats_instructions(s), frames = s->frames ? s->frames : 1;
+
+    fprintf(out, "\n%llu frames, %llu instructions (%llu skipped idle).\n",
+            (unsigned long long)s->frames, (unsigned long long)n,
+            (unsigned long long)s->idle);
+    fprintf(out, "Instructions per frame: %.1f (min %llu, max %llu).\n",
+            (double)n / frames,
+            (unsigned long long)(s->frames ? s->ipf_min : 0),
+            (unsigned long long)s->ipf_max);
+    fprintf(out,
+            "Host time per frame: %.1f us emulating, %.1f us rendering, "
+            "%.1f us on audio.\n",
+            s->emulation_ns / 1e3 / frames, s->render_ns / 1e3 / frames,
+            s->audio_ns / 1e3 / frames);
+    if (!s->headless)
+        fprintf(out, "%llu draw calls, ", (unsigned long long)s->draws);
+    fprintf(out, "%llu frames changed the screen.\n",
+            (unsigned long long)s->dirty_frames);
+    for (uint8_t i = 0; i < 16; i++)
+        if (s->ops[i])
+            fprintf(out, "%-12s %14llu %6.2f%%\n", OP_CLASSES[i],
+                    (unsigned long long)s->ops[i], 100.0 * s->ops[i] / n);
+}
+
+void stats_print_json(const stats_t *s, FILE *out)
+{
+    fprintf(out, "{\"frames\": %llu, \"instructions\": %llu, "
+                 "\"idle\": %llu, ",
+            (unsigned long long)s->frames,
+            (unsigned long long)stats_instructions(s),
+            (unsigned long long)s->idle);
+    fprintf(out, "\"ipf_min\": %llu, \"ipf_max\": %llu, ",
+            (unsigned long long)(s->frames ? s->ipf_min : 0),
+            (unsigned long long)s->ipf_max);
+    fprintf(out, "\"emulation_ns\": %llu, \"render_ns\": %llu, "
+                 "\"audio_ns\": %llu, ",
+            (unsigned long long)s->emulation_ns,
+            (unsigned long long)s->render_ns,
+            (unsigned long long)s->audio_ns);
+    if (!s->headless)
+        fprintf(out, "\"draws\": %llu, ", (unsigned long long)s->draws);
+    fprintf(out, "\"dirty_frames\": %llu, \"ops\": {",
+            (unsigned long long)s->dirty_frames);
+    for (uint8_t i = 0; i < 16; i++)
+        fprintf(out, "%s\"%.4s\": %llu", i ? ", " : "", OP_CLASSES[i],
+                (unsigned long long)s->ops[i]);
+    fprintf(out, "}}\n");
+}
+
+/**
+ * Frame hooks of chip8_run_frame. They only look at the machine: a frame
+ * that draws is one that ran CLS or DRW. Each hook returns the time it was
+ * called at.
+ */
+uint64_t stats_frame_begin(chip8_t *c8)
+{
+    c8->stats->before = stats_instructions(c8->stats);
+    c8->stats->drawn = c8->drawn;
+    return clock_ns();
+}
+
+uint64_t stats_frame_emulated(chip8_t *c8, uint64_t start)
+{
+    stats_t *s = c8->stats;
+    uint64_t now = clock_ns(), n = stats_instructions(s) - s->before;
+
+    s->emulation_ns += now - start;
+    s->dirty_frames += c8->drawn != s->drawn;
+    s->ipf_min = n < s->ipf_min ? n : s->ipf_min;
+    s->ipf_max = n > s->ipf_max ? n : s->ipf_max;
+    return now;
+}
+
+void stats_frame_end(chip8_t *c8, uint64_t start)
+{
+    stats_t *s = c8->stats;
+    uint64_t now = clock_ns();
+
+    s->audio_ns += now - start;
+    s->frames++;
+    if (!s->json && now - s->reported >= STATS_INTERVAL)
+    {
+        stats_print(s, stderr);
+        s->reported = now;
+    }
+}
+
+/**
+ * Runs one 1/60 s frame: host events are polled once, the frame's share of
+ * `hz` instructions run, and the timers tick. Shares are whole numbers that
+ * add up to exactly `hz` every TARGET_FPS frames, the remainder carried in
+ * `cycles`. However fast frames are run, the timers therefore always tick
+ * TARGET_FPS times per `hz` instructions. A ROM waiting for a key ends its
+ * frame early with `waiting` set, and its Fx0A runs again next frame; timers
+ * and sound go on meanwhile. Once the input says the run is over, returns
+ * false without running the frame.
+ */
+_Bool chip8_run_frame(chip8_t *c8)
+{
+    c8->waiting = false;
+    if (!c8->input.poll(c8->input.ctx))
+    {
+        c8->quit = true;
+        return false;
+    }
+    c8->keys = c8->input.keys(c8->input.ctx);
+
+    c8->state.cycles += c8->hz;
+    uint32_t n = c8->state.cycles / TARGET_FPS;
+    c8->state.cycles %= TARGET_FPS;
+
+    uint64_t t = c8->stats ? stats_frame_begin(c8) : 0;
+#ifdef DYNAREC_SUPPORTED
+    if (c8->dynarec)
+        dynarec_step(c8, n);
+    else
+#endif
+        chip8_step(c8, n);
+    if (c8->stats)
+        t = stats_frame_emulated(c8, t);
+
+    if (c8->state.dt)
+        c8->state.dt--;
+
+    c8->audio.buzz(c8->audio.ctx, c8->state.st);
+    if (c8->state.st)
+        c8->state.st--;
+    if (c8->stats)
+        stats_frame_end(c8, t);
+
+    return true;
+}
+
+// Draws the screen if CLS or DRW changed it since it was last drawn.
+void chip8_present(chip8_t *c8)
+{
+    if (c8->dirty)
+    {
+        uint64_t t = c8->stats ? clock_ns() : 0;
+        c8->video.draw(c8->video.ctx, c8->state.screen);
+        c8->dirty = false;
+        if (c8->stats)
+        {
+            c8->stats->render_ns += clock_ns() - t;
+            c8->stats->draws++;
+        }
+    }
+}
+
+/**
+ * Puts the machine in `state`, as after a load or a rewind. Every cached
+ * decoding or translation of the old RAM is dropped.
+ */
+void chip8_restore(chip8_t *c8, const state_t *state)
+{
+    c8->state = *state;
+    c8->dirty = true;
+    c8->stuck = false;
+    for (uint16_t a = 0; a < 4096; a++)
+        c8->decoded[a].exec = op_decode;
+#ifdef DYNAREC_SUPPORTED
+    if (c8->dynarec)
+        dynarec_flush(c8->dynarec);
+#endif
+}
+
+const char STATE_MAGIC[8] = "CH8STATE";
+
+/**
+ * A snapshot file is STATE_MAGIC, the size of state_t and the state itself
+ * in host byte order: instant to write and read back, but only by the same
+ * build on the same kind of machine.
+ */
+_Bool state_save(const state_t *state, const char *path)
+{
+    uint32_t size = sizeof(*state);
+    FILE *fptr = fopen(path, "wb");
+    _Bool ok = fptr && fwrite(STATE_MAGIC, 8, 1, fptr) &&
+               fwrite(&size, 4, 1, fptr) && fwrite(state, size, 1, fptr);
+
+    if (fptr && fclose(fptr))
+        ok = false;
+    return ok;
+}
+
+_Bool state_load(state_t *state, const char *path)
+{
+    char magic[8];
+    uint32_t size;
+    FILE *fptr = fopen(path, "rb");
+    _Bool ok = fptr && fread(magic, 8, 1, fptr) &&
+               !memcmp(magic, STATE_MAGIC, 8) && fread(&size, 4, 1, fptr) &&
+               size == sizeof(*state) && fread(state, size, 1, fptr) &&
+               state->sp <= 16;
+
+    if (fptr)
+        fclose(fptr);
+    return ok;
+}
+
+/**
+ * XORs `a` with `b` and run-length encodes the result into `out` as
+ * (equal bytes, differing bytes) pairs of uint16_t, each followed by the
+ * differing bytes XORed. Trailing equal bytes take no room at all. Returns
+ * the encoded length.
+ */
+size_t delta_encode(const uint8_t *a, const uint8_t *b, size_t n,
+                    uint8_t *out)
+{
+    size_t len = 0;
+
+    for (size_t i = 0; i < n;)
+    {
+        uint16_t same = 0, diff = 0;
+        for (; i < n && a[i] == b[i]; i++)
+            same++;
+        while (i + diff < n && a[i + diff] != b[i + diff])
+            diff++;
+        if (!diff)
+            break;
+
+        memcpy(out + len, &same, 2);
+        memcpy(out + len + 2, &diff, 2);
+        len += 4;
+        for (; diff; diff--, i++)
+            out[len++] = a[i] ^ b[i];
+    }
+
+    return len;
+}
+
+// XORs a delta_encode result back into `a`.
+void delta_apply(uint8_t *a, const uint8_t *in, size_t len)
+{
+    for (size_t i = 0, p = 0; p < len;)
+    {
+        uint16_t same, diff;
+        memcpy(&same, in + p, 2);
+        memcpy(&diff, in + p + 2, 2);
+        p += 4;
+        for (i += same; diff; diff--)
+            a[i++] ^= in[p++];
+    }
+}
+
+/**
+ * The machine's recent past, one entry per frame, in a ring of
+ * REWIND_BUFFER_SIZE bytes that forgets the oldest frames when full. An
+ * entry is the delta_encode of a frame's state against the frame before,
+ * framed by its length on both sides so the ring can be walked either way.
+ * Consecutive frames share almost every byte, so most entries take a few
+ * dozen bytes and minutes of play fit in a few MB.
+ */
+typedef struct __rewind_struct
+{
+    uint8_t *ring;
+    size_t head; // where the oldest entry starts
+    size_t used;
+    state_t last; // the state the newest entry leads to
+    uint8_t delta[4 * sizeof(state_t)];
+} rewind_t;
+
+void rewind_init(rewind_t *rw, const state_t *state)
+{
+    rw->ring = malloc(REWIND_BUFFER_SIZE);
+    if (!rw->ring)
+        panic(BRED "RUNTIME ERROR:" RES " Out of memory.");
+    rw->head = rw->used = 0;
+    rw->last = *state;
+}
+
+void rewind_write(rewind_t *rw, size_t pos, const void *src, size_t n)
+{
+    pos %= REWIND_BUFFER_SIZE;
+    size_t first = n < REWIND_BUFFER_SIZE - pos ? n : REWIND_BUFFER_SIZE - pos;
+    memcpy(rw->ring + pos, src, first);
+    memcpy(rw->ring, (const uint8_t *)src + first, n - first);
+}
+
+void rewind_read(rewind_t *rw, size_t pos, void *dst, size_t n)
+{
+    pos %= REWIND_BUFFER_SIZE;
+    size_t first = n < REWIND_BUFFER_SIZE - pos ? n : REWIND_BUFFER_SIZE - pos;
+    memcpy(dst, rw->ring + pos, first);
+    memcpy((uint8_t *)dst + first, rw->ring, n - first);
+}
+
+// Records `state` as the newest frame.
+void rewind_push(rewind_t *rw, const state_t *state)
+{
+    uint32_t len = delta_encode((const uint8_t *)state,
+                                (const uint8_t *)&rw->last, sizeof(*state),
+                                rw->delta);
+
+    while (rw->used + len + 8 > REWIND_BUFFER_SIZE)
+    {
+        uint32_t oldest;
+        rewind_read(rw, rw->head, &oldest, 4);
+        rw->head = (rw->head + oldest + 8) % REWIND_BUFFER_SIZE;
+        rw->used -= oldest + 8;
+    }
+
+    size_t tail = rw->head + rw->used;
+    rewind_write(rw, tail, &len, 4);
+    rewind_write(rw, tail + 4, rw->delta, len);
+    rewind_write(rw, tail + 4 + len, &len, 4);
+    rw->used += len + 8;
+    rw->last = *state;
+}
+
+// Steps back one frame into `state`; false once the history runs out.
+_Bool rewind_pop(rewind_t *rw, state_t *state)
+{
+    if (!rw->used)
+        return false;
+
+    size_t tail = rw->head + rw->used;
+    uint32_t len;
+    rewind_read(rw, tail - 4, &len, 4);
+    rewind_read(rw, tail - 4 - len, rw->delta, len);
+    delta_apply((uint8_t *)&rw->last, rw->delta, len);
+    rw->used -= len + 8;
+    *state = rw->last;
+    return true;
+}
+
+// "CH8MOVIE" movies stored instructions per frame where `hz` is now.
+const char MOVIE_MAGIC[8] = "CH8MOV02";
+
+/**
+ * A movie is everything a run read from its input, so that it can be run
+ * again exactly: a header (MOVIE_MAGIC, then the RND seed and `hz` as
+ * little-endian uint32_t) and a record per change of the key mask, which
+ * is sampled once per frame. A record is the number of frames since the
+ * previous one, as a LEB128 varint, and the new mask in two bytes. A last
+ * record, changed or not, marks how many frames the run took.
+ */
+typedef struct __movie_struct
+{
+    FILE *file;
+    input_t host;     // the input being recorded
+    uint64_t sample;  // frames sampled so far
+    uint64_t next;    // the sample of the next (replay) or last record
+    uint16_t mask;    // the current mask
+    uint16_t pending; // the mask of the next record, when replaying
+    _Bool more;       // there is a next record to replay
+} movie_t;
+
+void movie_write(movie_t *mv, uint64_t delta, uint16_t mask)
+{
+    do
+    {
+        fputc((delta & 0x7F) | (delta > 0x7F ? 0x80 : 0), mv->file);
+        delta >>= 7;
+    } while (delta);
+    fputc(mask & 0xFF, mv->file);
+    fputc(mask >> 8, mv->file);
+}
+
+_Bool movie_read(movie_t *mv, uint64_t *delta, uint16_t *mask)
+{
+    int c, lo, hi;
+
+    *delta = 0;
+    for (uint8_t shift = 0;; shift += 7)
+    {
+        if ((c = fgetc(mv->file)) == EOF || shift > 63)
+            return false;
+        *delta |= (uint64_t)(c & 0x7F) << shift;
+        if (!(c & 0x80))
+            break;
+    }
+    if ((lo = fgetc(mv->file)) == EOF || (hi = fgetc(mv->file)) == EOF)
+        return false;
+    *mask = lo | hi << 8;
+    return true;
+}
+
+_Bool movie_record_poll(void *ctx)
+{
+    movie_t *mv = ctx;
+    return mv->host.poll(mv->host.ctx);
+}
+
+uint16_t movie_record_keys(void *ctx)
+{
+    movie_t *mv = ctx;
+    uint16_t keys = mv->host.keys(mv->host.ctx);
+
+    mv->sample++;
+    if (keys != mv->mask)
+    {
+        movie_write(mv, mv->sample - mv->next, keys);
+        mv->next = mv->sample;
+        mv->mask = keys;
+    }
+    return keys;
+}
+
+_Bool movie_record_wait(void *ctx, uint32_t ms)
+{
+    movie_t *mv = ctx;
+    return mv->host.wait(mv->host.ctx, ms);
+}
+
+// Starts recording everything `c8` reads from its current input.
+void movie_record(movie_t *mv, chip8_t *c8, const char *path, uint32_t seed)
+{
+    uint8_t header[16];
+
+    mv->file = fopen(path, "wb");
+    if (!mv->file)
+        panic(RED "RUNTIME ERROR:" RES " Could not open file \"%s\".", path);
+
+    memcpy(header, MOVIE_MAGIC, 8);
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        header[8 + i] = seed >> 8 * i;
+        header[12 + i] = c8->hz >> 8 * i;
+    }
+    fwrite(header, 1, sizeof(header), mv->file);
+
+    mv->host = c8->input;
+    c8->input = (input_t){mv, movie_record_poll, movie_record_keys,
+                          movie_record_wait};
+}
+
+void movie_finish(movie_t *mv)
+{
+    movie_write(mv, mv->sample - mv->next, mv->mask);
+    if (fclose(mv->file))
+        panic(RED "RUNTIME ERROR:" RES " Could not write the movie.");
+}
+
+// The replayed run goes on for as long as the recorded one did.
+_Bool movie_replay_poll(void *ctx)
+{
+    movie_t *mv = ctx;
+    return mv->more || mv->sample < mv->next;
+}
+
+// The movie already knows when keys went down, so there is no waiting.
+_Bool movie_replay_wait(void *ctx, uint32_t ms)
+{
+    (void)ctx;
+    (void)ms;
+    return true;
+}
+
+uint16_t movie_replay_keys(void *ctx)
+{
+    movie_t *mv = ctx;
+    uint64_t delta;
+
+    mv->sample++;
+    while (mv->more && mv->next <= mv->sample)
+    {
+        mv->mask = mv->pending;
+        mv->more = movie_read(mv, &delta, &mv->pending);
+        if (mv->more)
+            mv->next += delta;
+    }
+    return mv->mask;
+}
+
+/**
+ * Feeds a movie to `c8` in place of its input, and returns the seed and
+ * `hz` it was recorded with through `seed` and `c8->hz`.
+ */
+void movie_replay(movie_t *mv, chip8_t *c8, const char *path,
+                  uint32_t *seed)
+{
+    uint8_t header[16];
+    uint64_t delta;
+
+    mv->file = fopen(path, "rb");
+    if (!mv->file || fread(header, 1, sizeof(header), mv->file) != 16)
+        panic(RED "RUNTIME ERROR:" RES " Could not read movie \"%s\".", path);
+    if (!memcmp(header, "CH8MOVIE", 8))
+        panic(RED "RUNTIME ERROR:" RES " Movie \"%s\" is from an older "
+                  "version and would not replay the same.",
+              path);
+    if (memcmp(header, MOVIE_MAGIC, 8))
+        panic(RED "RUNTIME ERROR:" RES " Could not read movie \"%s\".", path);
+
+    *seed = c8->hz = 0;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        *seed |= (uint32_t)header[8 + i] << 8 * i;
+        c8->hz |= (uint32_t)header[12 + i] << 8 * i;
+    }
+
+    mv->more = movie_read(mv, &delta, &mv->pending);
+    mv->next = delta;
+    c8->input = (input_t){mv, movie_replay_poll, movie_replay_keys,
+                          movie_replay_wait};
+}
+
+void headless_draw(void *ctx, const uint64_t *screen)
+{
+    (void)ctx;
+    (void)screen;
+}
+
+void headless_buzz(void *ctx, _Bool on)
+{
+    (void)ctx;
+    (void)on;
+}
+
+_Bool headless_poll(void *ctx)
+{
+    (void)ctx;
+    return true;
+}
+
+uint16_t headless_keys(void *ctx)
+{
+    (void)ctx;
+    return 0;
+}
+
+// Nobody will ever press a key, so a ROM waiting for one is done.
+_Bool headless_wait(void *ctx, uint32_t ms)
+{
+    (void)ctx;
+    (void)ms;
+    return false;
+}
+
+void headless_attach(chip8_t *c8)
+{
+    c8->video = (video_t){NULL, headless_draw};
+    c8->audio = (audio_t){NULL, headless_buzz};
+    c8->input =
+        (input_t){NULL, headless_poll, headless_keys, headless_wait};
+}
+
+typedef struct __sdl_struct
+{
+    SDL_Window *window;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    SDL_AudioDeviceID dev;
+    uint32_t scale;
+    uint32_t palette[2]; // ARGB of unlit and lit pixels
+    _Bool rects;
+    _Bool save_state, load_state; // SAVE/LOAD_STATE_KEY pressed, not handled
+    uint32_t expand[256][8];
+    uint32_t pixels[32][64];
+} sdl_t;
+
+/**
+ * Fills `expand` so that the eight pixels of a screen byte, most
+ * significant bit first, are one 32-byte copy away.
+ */
+void sdl_build_palette(sdl_t *sdl)
+{
+    for (uint32_t byte = 0; byte < 256; byte++)
+        for (uint8_t bit = 0; bit < 8; bit++)
+            sdl->expand[byte][bit] = sdl->palette[(byte >> (7 - bit)) & 1];
+}
+
+/**
+ * Expands the 1-bit screen into `pixels`, one table lookup per byte, and
+ * lets the GPU scale it to the window with a single copy.
+ */
+void sdl_draw_texture(void *ctx, const uint64_t *screen)
+{
+    sdl_t *sdl = ctx;
+
+    for (uint8_t y = 0; y < 32; y++)
+        for (uint8_t i = 0; i < 8; i++)
+            memcpy(sdl->pixels[y] + 8 * i,
+                   sdl->expand[(uint8_t)(screen[y] >> (56 - 8 * i))],
+                   sizeof(sdl->expand[0]));
+
+    SDL_UpdateTexture(sdl->texture, NULL, sdl->pixels,
+                      sizeof(sdl->pixels[0]));
+    SDL_RenderCopy(sdl->renderer, sdl->texture, NULL, NULL);
+    SDL_RenderPresent(sdl->renderer);
+}
+
+void sdl_draw_rects(void *ctx, const uint64_t *screen)
+{
+    sdl_t *sdl = ctx;
+    uint32_t off = sdl->palette[0], on = sdl->palette[1];
+    SDL_Rect rect;
+
+    SDL_SetRenderDrawColor(sdl->renderer, off >> 16, off >> 8, off, 255);
+    SDL_RenderClear(sdl->renderer);
+    SDL_SetRenderDrawColor(sdl->renderer, on >> 16, on >> 8, on, 255);
+
+    for (uint8_t y = 0; y < 32; y++)
+    {
+        for (uint8_t x = 0; x < 64; x++)
+        {
+            if (screen[y] & (1ll << (63 - x)))
+            {
+                rect = (SDL_Rect){.x = x * sdl->scale,
+                                  .y = y * sdl->scale,
+                                  .w = sdl->scale,
+                                  .h = sdl->scale};
+                SDL_RenderFillRect(sdl->renderer, &rect);
+            }
+        }
+    }
+
+    SDL_RenderPresent(sdl->renderer);
+}
+
+void sdl_buzz(void *ctx, _Bool on)
+{
+    SDL_PauseAudioDevice(((sdl_t *)ctx)->dev, !on);
+}
+
+_Bool sdl_poll(void *ctx)
+{
+    sdl_t *sdl = ctx;
+    SDL_Event e;
+
+    while (SDL_PollEvent(&e))
+    {
+        if (e.type == SDL_QUIT)
+            return false;
+        if (e.type == SDL_KEYDOWN && !e.key.repeat)
+        {
+            sdl->save_state |= e.key.keysym.scancode == SAVE_STATE_KEY;
+            sdl->load_state |= e.key.keysym.scancode == LOAD_STATE_KEY;
+        }
+    }
+    return true;
+}
+
+uint16_t sdl_keys(void *ctx)
+{
+    const uint8_t *keyboard_state = SDL_GetKeyboardState(NULL);
+    uint16_t keys = 0;
+
+    (void)ctx;
+    for (uint8_t i = 0; i < 16; i++)
+        keys |= keyboard_state[keyboard[i]] << i;
+    return keys;
+}
+
+/**
+ * Blocks on the event queue until a key goes down, the user quits or `ms`
+ * pass. The event that ends the wait is put back for sdl_poll.
+ */
+_Bool sdl_wait(void *ctx, uint32_t ms)
+{
+    uint32_t deadline = SDL_GetTicks() + ms;
+    SDL_Event e;
+
+    (void)ctx;
+    for (int32_t left = ms; left > 0; left = deadline - SDL_GetTicks())
+    {
+        if (!SDL_WaitEventTimeout(&e, left))
+            break;
+        if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN)
+        {
+            SDL_PushEvent(&e);
+            break;
+        }
+    }
+    return true;
+}
+
+void sdl_attach(sdl_t *sdl, chip8_t *c8)
+{
+    SDL_Init(SDL_INIT_VIDEO);
+
+    sdl->window = SDL_CreateWindow(
+        "CHIP-8 Emulator", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+        64 * sdl->scale, 32 * sdl->scale, 0);
+
+    sdl->renderer =
+        SDL_CreateRenderer(sdl->window, -1, SDL_RENDERER_ACCELERATED);
+
+    if (!sdl->rects)
+    {
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+        sdl->texture =
+            SDL_CreateTexture(sdl->renderer, SDL_PIXELFORMAT_ARGB8888,
+                              SDL_TEXTUREACCESS_STREAMING, 64, 32);
+        if (!sdl->texture)
+            panic(BRED "RUNTIME ERROR:" RES " Could not create texture: %s.",
+                  SDL_GetError());
+        sdl_build_palette(sdl);
+    }
+
+    SDL_Init(SDL_INIT_AUDIO);
+
+    SDL_AudioSpec want, have;
+    SDL_zero(want);
+    want.freq = 44100;
+    want.format = AUDIO_S16SYS;
+    want.channels = 1;
+    want.samples = 512;
+    want.callback = audio_callback;
+
+    sdl->dev = SDL_OpenAudioDevice(NULL, 0, &want, &have, 0);
+
+    c8->video =
+        (video_t){sdl, sdl->rects ? sdl_draw_rects : sdl_draw_texture};
+    c8->audio = (audio_t){sdl, sdl_buzz};
+    c8->input = (input_t){sdl, sdl_poll, sdl_keys, sdl_wait};
+}
+
+void sdl_detach(sdl_t *sdl)
+{
+    SDL_CloseAudioDevice(sdl->dev);
+    if (sdl->texture)
+        SDL_DestroyTexture(sdl->texture);
+    SDL_DestroyRenderer(sdl->renderer);
+    SDL_DestroyWindow(sdl->window);
+    SDL_Quit();
+}
+
+/**
+ * Paces frames at exactly TARGET_FPS on a monotonic nanosecond clock.
+ * Frame k is due `k / TARGET_FPS` seconds after `start`, worked out from
+ * the frame count every time, so rounding never builds up into drift. A
+ * frame still running at its deadline is late; one that falls more than
+ * MAX_LAG_FRAMES behind (a stalled host, a suspended laptop) starts the
+ * schedule over instead of rushing through the backlog.
+ */
+typedef struct __pacer_struct
+{
+    uint64_t start; // ns
+    uint64_t frame; // frames paced since `start`
+    uint64_t paced, late;
+} pacer_t;
+
+void pacer_start(pacer_t *p)
+{
+    p->start = clock_ns();
+    p->frame = 0;
+}
+
+// When the frame being run is due to end.
+uint64_t pacer_deadline(const pacer_t *p)
+{
+    return p->start + (p->frame + 1) * 1000000000ull / TARGET_FPS;
+}
+
+/**
+ * Ends the frame ahead of its deadline, the next one starting right away.
+ * The schedule stays put, so the frame after that is due as it always was.
+ */
+void pacer_resume(pacer_t *p)
+{
+    p->frame++;
+    p->paced++;
+}
+
+// Sleeps until the frame's deadline; the next frame starts then.
+void pacer_wait(pacer_t *p)
+{
+    uint64_t deadline = pacer_deadline(p), now = clock_ns();
+
+    p->frame++;
+    p->paced++;
+    if (now >= deadline)
+    {
+        p->late++;
+        if (now - deadline > MAX_LAG_FRAMES * FRAME_NS)
+            pacer_start(p);
+        return;
+    }
+
+#ifdef __unix__
+    struct timespec ts = {.tv_sec = deadline / 1000000000,
+                          .tv_nsec = deadline % 1000000000};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) ==
+           EINTR)
+        ;
+#else
+    SDL_Delay((deadline - now) / 1000000);
+    while (clock_ns() < deadline)
+        ;
+#endif
+}
+
+int main(int argc, char **argv)
+{
+    static sdl_t sdl = {.scale = CELL_SIZE,
+                        .palette = {0xFF000000, 0xFFFFFFFF}};
+    _Bool headless = false;
+    _Bool turbo = false;
+    _Bool dynarec = false;
+    const char *load_state = NULL, *save_state = NULL;
+    static char state_file[4096];
+    static state_t snapshot;
+    static rewind_t rw;
+    const char *record = NULL, *replay = NULL;
+    static movie_t movie;
+    static stats_t stats;
+    const char *stats_mode = NULL;
+    uint32_t seed = time(NULL);
+    uint64_t frames = 0;
+    uint32_t hz = CPU_HZ;
+    int arg = 1;
+    char *end;
+
+    for (; arg < argc - 1; arg++)
+    {
+        if (!strcmp(argv[arg], "--headless"))
+            headless = true;
+        else if (!strncmp(argv[arg], "--frames=", 9))
+            frames = strtoull(argv[arg] + 9, NULL, 10);
+        else if (!strncmp(argv[arg], "--scale=", 8))
+        {
+            sdl.scale = strtoul(argv[arg] + 8, NULL, 10);
+            if (!sdl.scale)
+                sdl.scale = 1;
+        }
+        else if (!strncmp(argv[arg], "--palette=", 10))
+        {
+            sdl.palette[0] = 0xFF000000 | strtoul(argv[arg] + 10, &end, 16);
+            if (*end == ',')
+                sdl.palette[1] = 0xFF000000 | strtoul(end + 1, NULL, 16);
+        }
+        else if (!strcmp(argv[arg], "--rects"))
+            sdl.rects = true;
+        else if (!strncmp(argv[arg], "--hz=", 5))
+            hz = strtoul(argv[arg] + 5, NULL, 10);
+        else if (!strncmp(argv[arg], "--ipf=", 6))
+            hz = strtoul(argv[arg] + 6, NULL, 10) * TARGET_FPS;
+        else if (!strcmp(argv[arg], "--turbo"))
+            turbo = true;
+        else if (!strcmp(argv[arg], "--dynarec"))
+            dynarec = true;
+        else if (!strncmp(argv[arg], "--seed=", 7))
+            seed = strtoul(argv[arg] + 7, NULL, 10);
+        else if (!strncmp(argv[arg], "--record=", 9))
+            record = argv[arg] + 9;
+        else if (!strncmp(argv[arg], "--replay=", 9))
+        {
+            replay = argv[arg] + 9;
+            headless = true;
+        }
+        else if (!strncmp(argv[arg], "--load-state=", 13))
+            load_state = argv[arg] + 13;
+        else if (!strncmp(argv[arg], "--save-state=", 13))
+            save_state = argv[arg] + 13;
+        else if (!strcmp(argv[arg], "--stats"))
+            stats_mode = "text";
+        else if (!strncmp(argv[arg], "--stats=", 8))
+            stats_mode = argv[arg] + 8;
+        else
+            break;
+    }
+
+    if (arg >= argc)
+        return 1;
+
+    static chip8_t c8;
+    chip8_init(&c8);
+    chip8_load(&c8, argv[arg]);
+    c8.hz = hz;
+    if (stats_mode)
+    {
+        stats_init(&stats, !strcmp(stats_mode, "json"), headless);
+        c8.stats = &stats;
+    }
+    snprintf(state_file, sizeof(state_file), "%s.state", argv[arg]);
+
+#ifdef DYNAREC_SUPPORTED
+    static dynarec_t dr;
+    if (dynarec)
+        dynarec_attach(&dr, &c8);
+#else
+    if (dynarec)
+        fprintf(stderr, "Dynarec not available on this platform.\n");
+#endif
+
+    if (headless)
+        headless_attach(&c8);
+    else
+        sdl_attach(&sdl, &c8);
+
+    // A movie brings its own seed; a saved state brings its own RND state.
+    if (replay)
+        movie_replay(&movie, &c8, replay, &seed);
+    else if (record)
+        movie_record(&movie, &c8, record, seed);
+    chip8_seed(&c8, seed);
+
+    if (load_state)
+    {
+        if (!state_load(&snapshot, load_state))
+            panic(RED "RUNTIME ERROR:" RES " Could not load state \"%s\".",
+                  load_state);
+        chip8_restore(&c8, &snapshot);
+    }
+
+    if (!headless)
+        rewind_init(&rw, &c8.state);
+
+    pacer_t pacer = {.start = 0, .frame = 0, .paced = 0, .late = 0};
+    uint64_t shown = 0;
+    pacer_start(&pacer);
+
+    for (uint64_t frame = 0; !frames || frame < frames; frame++)
+    {
+        if (headless)
+        {
+            // A stuck ROM's screen is final, and nobody hears the buzzer.
+            // A replay still runs every frame of its movie, for the timers
+            // and `cycles` to end as they were recorded.
+            if (!chip8_run_frame(&c8) || (c8.stuck && !replay))
+                break;
+            if (c8.waiting && !c8.input.wait(c8.input.ctx, 0))
+                break;
+            continue;
+        }
+
+        // A movie only replays if the run never went back in time.
+        _Bool rewinding = !record && SDL_GetKeyboardState(NULL)[REWIND_KEY];
+        if (rewinding)
+        {
+            // Frames go back one by one, silently, while the key is held.
+            if (!c8.input.poll(c8.input.ctx))
+                break;
+            c8.audio.buzz(c8.audio.ctx, false);
+            if (rewind_pop(&rw, &snapshot))
+                chip8_restore(&c8, &snapshot);
+        }
+        else
+        {
+            if (!chip8_run_frame(&c8))
+                break;
+            rewind_push(&rw, &c8.state);
+        }
+
+        if (sdl.save_state)
+        {
+            sdl.save_state = false;
+            if (!state_save(&c8.state, save_state ? save_state : state_file))
+                printf(RED "RUNTIME ERROR:" RES " Could not save state.\n");
+        }
+        if (sdl.load_state && !record)
+        {
+            sdl.load_state = false;
+            if (state_load(&snapshot, save_state ? save_state : state_file))
+            {
+                chip8_restore(&c8, &snapshot);
+                rewind_push(&rw, &c8.state);
+            }
+            else
+                printf(RED "RUNTIME ERROR:" RES " Could not load state.\n");
+        }
+
+        // Unthrottled, frames are only shown as often as they would be at
+        // TARGET_FPS; the rest are emulated but never drawn. A ROM waiting
+        // for a key waits at TARGET_FPS all the same, and rewinding always
+        // goes back at TARGET_FPS.
+        if (!c8.waiting && !rewinding &&
+            (turbo || SDL_GetKeyboardState(NULL)[FAST_FORWARD_KEY]))
+        {
+            uint64_t now = clock_ns();
+            if (now - shown >= FRAME_NS)
+            {
+                chip8_present(&c8);
+                shown = now;
+            }
+            pacer_start(&pacer);
+            continue;
+        }
+
+        chip8_present(&c8);
+
+        shown = clock_ns();
+
+        // A key that ends a wait early resumes the CPU right away, with
+        // the next frame. Frames stay on their schedule, so no key can make
+        // the timers tick faster than TARGET_FPS.
+        uint64_t deadline = pacer_deadline(&pacer);
+        if (c8.waiting && !rewinding && deadline > shown)
+        {
+            c8.input.wait(c8.input.ctx, (deadline - shown) / 1000000);
+            if (clock_ns() + 1000000 < deadline)
+            {
+                pacer_resume(&pacer);
+                continue;
+            }
+        }
+        pacer_wait(&pacer);
+    }
+
+    if (headless)
+    {
+        dump_screen(stdout, c8.state.screen);
+        if (save_state && !state_save(&c8.state, save_state))
+            panic(RED "RUNTIME ERROR:" RES " Could not save state \"%s\".",
+                  save_state);
+    }
+    else
+    {
+        sdl_detach(&sdl);
+        free(rw.ring);
+        if (pacer.late)
+            fprintf(stderr, "%llu of %llu frames ran late.\n",
+                    (unsigned long long)pacer.late,
+                    (unsigned long long)pacer.paced);
+    }
+
+    if (record)
+        movie_finish(&movie);
+    else if (replay)
+        fclose(movie.file);
+
+    if (stats_mode && stats.json)
+        stats_print_json(&stats, stderr);
+    else if (stats_mode)
+        stats_print(&stats, stderr);
+
+#ifdef DYNAREC_SUPPORTED
+    if (dynarec)
+        dynarec_detach(&dr);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+Towers of Hanoi
+Solves the puzzle for 16 disks and prints all 65535 moves as
+Disk K from X to Y
+Disk numbers and the recursion stack are kept as 16 bit cell pairs
+
+>>>>>>>>>>[-]+>>>[-]+>>>>>>>>>><<<[-]+>>>[-]++>>>>>>>>>><<<[-]+>>>[-]+>>>>>>>>>>
+<<<[-]+>>>[-]++>>>>>>>>>><<<[-]+>>>[-]+>>>>>>>>>><<<[-]+>>>[-]++>>>>>>>>>><<<[-]
++>>>[-]+>>>>>>>>>><<<[-]+>>>[-]++>>>>>>>>>><<<[-]+>>>[-]+>>>>>>>>>><<<[-]+>>>[-]
+++>>>>>>>>>><<<[-]+>>>[-]+>>>>>>>>>><<<[-]+>>>[-]++>>>>>>>>>><<<[-]+>>>[-]+>>>>>
+>>>>><<<[-]+>>>[-]++>>>>>>>>>><<<[-]+>>>[-]+>>>>>>>>>><<<[-]+>>>[-]++<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]-[>[-]
+-[>>>>>>>>>>>>[-]+<<<[[-]>>>[->>>>>>>>>>+<<<<<<<<<<]>[->>>>>>>>>>+<<<<<<<<<<]>>>
+>>>>>>><+[->>>+>+<<<<]>>>>[-<<<<+>>>>]<----------<[-]+>[->+<]>[<<[-]>>[-<+>]]<[-
+]<[-<<[-]>+>]<<<<<][-]+>>>>>[-]+++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++.+++++++++++++++++++++++++++++++++++++.++++++++++.--------.--
+-------------------------------------------------------------------------.[-][-]
+<[->>+<<]>>[<[-]+>[-<<+>>]]<[-<++++++++++++++++++++++++++++++++++++++++++++++++.
+------------------------------------------------>]<<++++++++++++++++++++++++++++
+++++++++++++++++++++.[-]>[-]>[-]++++++++++++++++++++++++++++++++.+++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++.++++++++++++.---.--.----
+-------------------------------------------------------------------------.[-]<<<
+<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++.[-]<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[-<<<<+>>>>]<<<<[->>>>
+>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<---<[-]+>[->+<]>[<<[-]>>[-<+>]]<[-]<[-<<<<[-]>
+>>>]<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<----<[-]+>[->+<]>[<<[-]>>[-<+>]]
+<[-]<[-<<<<[-]+>>>>][-]++++++++++++++++++++++++++++++++.++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.-----.-------------
+------------------------------------------------------------------.[-]<<<<[->>>>
++>+<<<<<]>>>>>[-<<<<<+>>>>>]<+++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++.[-][-]++++++++++.[-]<<<<<<[<<<<<<<<<<]>>-]>>>>>>>>>>>>[-]+<<<[[-]
+>>>[->>>>>>>>>>+<<<<<<<<<<]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>><+[->>>+>+<<<<]>>>
+>[-<<<<+>>>>]<----------<[-]+>[->+<]>[<<[-]>>[-<+>]]<[-]<[-<<[-]>+>]<<<<<][-]+>>
+>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.+++++
+++++++++++++++++++++++++++++++++.++++++++++.--------.---------------------------
+------------------------------------------------.[-][-]<[->>+<<]>>[<[-]+>[-<<+>>
+]]<[-<++++++++++++++++++++++++++++++++++++++++++++++++.-------------------------
+----------------------->]<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]>
+[-]>[-]++++++++++++++++++++++++++++++++.++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++.++++++++++++.---.--.-----------------------------
+------------------------------------------------.[-]<<<<[->>>>+>+<<<<<]>>>>>[-<<
+<<<+>>>>>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]
+<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[-<<<<+>>>>]<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<
++>>>>>>]<---<[-]+>[->+<]>[<<[-]>>[-<+>]]<[-]<[-<<<<[-]>>>>]<<<<[->>>>>+>+<<<<<<]
+>>>>>>[-<<<<<<+>>>>>>]<----<[-]+>[->+<]>[<<[-]>>[-<+>]]<[-]<[-<<<<[-]+>>>>][-]++
+++++++++++++++++++++++++++++++.+++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++.-----.--------------------------------------
+-----------------------------------------.[-]<<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>
+>>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-][-]++++
+++++++.[-]<<<<<<[<<<<<<<<<<]>>>>>>>>>>>>>>[-]+<<<[[-]>>>[->>>>>>>>>>+<<<<<<<<<<]
+>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>><+[->>>+>+<<<<]>>>>[-<<<<+>>>>]<----------<[-
+]+>[->+<]>[<<[-]>>[-<+>]]<[-]<[-<<[-]>+>]<<<<<][-]+>>>>>[-]+++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++.++++++++++++++++++++++++++++++++
++++++.++++++++++.--------.------------------------------------------------------
+---------------------.[-][-]<[->>+<<]>>[<[-]+>[-<<+>>]]<[-<+++++++++++++++++++++
++++++++++++++++++++++++++++.------------------------------------------------>]<<
+++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]>[-]++++++++++++++++++++
+++++++++++++.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++.++++++++++++.---.--.--------------------------------------------------------
+---------------------.[-]<<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<[->>>+>+<<<<]>>>>[-<<<<+
+>>>>]<[-<<<<+>>>>]<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<---<[-]+>[->+<]>[<
+<[-]>>[-<+>]]<[-]<[-<<<<[-]>>>>]<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<----
+<[-]+>[->+<]>[<<[-]>>[-<+>]]<[-]<[-<<<<[-]+>>>>][-]+++++++++++++++++++++++++++++
++++.++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++.-----.-----------------------------------------------------------------
+--------------.[-]<<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<+++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++.[-][-]++++++++++.[-]<<<<<<[<<<<<<<<<<
+]>-]
@@ -0,0 +1,7 @@
+Long output
+Prints 153000 lines of the alphabet for about 4 MB of output
+Almost all the time goes to output so it measures the IO path
+
+>>>>>[-]++++++++++<<<<<[-]+++[->[-]---------------------------------------------
+-----------[->[-]-[->[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++>[-]++++++++++++++++++++++++++[<.+>-]<[-]>>.<<<]<]<]
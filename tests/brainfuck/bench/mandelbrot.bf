@@ -0,0 +1,338 @@
+Mandelbrot set
+Plots 56 by 21 cells of the set in signed magnitude fixed point with four
+fraction bits and up to 40 iterations per cell
+Products are built from small multiply loops and the divmod idiom
+
+>>>[-]+>[-]++++++++++++++++++++<<<[-]+++++++++++++++++++++[->>>>[-]+>[-]++++++++
+++++++++++++++++++++++++++++++++<<<<<<[-]+++++++++++++++++++++++++++++++++++++++
++++++++++++++++++[->>>>>>>[-]>[-]>[-]>[-]<<<<<<<<[-]>>>>>>>>>[-]+[[-]>[-]+<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>]<----------------------------------------<[-]+>[->+<]>[<<
+[-]>>[-<+>]]<[-]<[-<<<<<<[-]>>>>>>]<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<
+<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+<<]>>[-<<+>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]>[-]<<<[-]<[->>+<<]>>[<[-]+>[-<<+>>]]<<[-]>[-<<<<<<<[-]>>>>>>>]<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++<[->-[>+>>
+]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[-]<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>
+>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[-]<[-]<<[-]<[->>+<<]>>[<[-]+>[-<<+>>]]<<[-]>[-<<<<<<<[-]>>>>>>>]
+<<<<<<<[-<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>++++++++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++
++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[->>>>+>+<<<<<]>>>>>[
+-<<<<<+>>>>>]<[-<<[-<<<<<<<<<<++++++++++++++++>>>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<]<
+<<<[->>>>>+<+<<<<]>>>>[-<<<<+>>>>]>[-<<[-<<<<<<<<<<<+>>>>>>>>>>>>+<]>[-<+>]>]<<<
+<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[-<<[-<<<<<<<<<<+>>>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<
+]>[-]<<<<[->>>>>>+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<[-<<<<[->>+>>>+<<<<<]>>>>>
+[-<<<<<+>>>>>]<]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>++++++++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>[-]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<[-]>[-]>[
+-]>[-]>>[-]>[-]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<+>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>++++++++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<[-]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<]>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<
+<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[-]<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[-]>>>>>>>>>>>>>[-<<<<+<+>>>>>]<<<<<[->>>>>+<<<<<]>[->>>[-<<<<<<<<<<<<++++++++
+++++++++>>>>>>>>+>>>>]<<<<[->>>>+<<<<]>]>>>>[-<<<<<+>+>>>>]<<<<[->>>>+<<<<]<[->>
+[-<<<<<<<<<<+>>>>>>>>>+>]<[->+<]<]>>>[-<<+<+>>>]<<<[->>>+<<<]>[->>>[-<<<<<<<<<<<
+<+>>>>>>>>+>>>>]<<<<[->>>>+<<<<]>]<[-]>>>[->>>>+<+<<<]>>>[-<<<+>>>]>[-<<<<<[-<<+
+>>>>>>+<<<<]>>>>[-<<<<+>>>>]>]<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++<[->-[>+>>]>[+[-<
++>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[-]<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[-<<<<<<<<<+>>>>>>>>>]>>>>[-]<<[-]>[-]<<[-]<<[-]<[-]<<<<<<
+<<[->>>>>>>>>+<<<<+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->>>>>+<+<<<<]>>>>[-<<<<+>>>>]>
+[->>>+<<<]>>>[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+<<]>>[-<<+>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]<<<<[-]>>[-<+>]<[<[-]+>[->+<]]>[-
+]<<<[-]+>[-<[-]>]<[-<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-
+]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++
+++++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>[->>>>+<+<<<]
+>>>[-<<<+>>>]>[-<<<<<[-<<<<<<++++++++++++++++>>>>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>]<
+<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[-<[-<<<<<<<<<+>>>>>>>>>>>+<<]>>[-<<+>>]<]<<[->
+>>+<+<<]>>[-<<+>>]>[-<<<<<[-<<<<<<+>>>>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>]<[-]<<[->>>
+>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[-<<<<[->+>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<]<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<]>>>>[-<<<
+<+>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++
++++++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<[-]>[-]<<[-]>>>[-]>[-]>>[-]<<
+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>[->>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<+<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<
+<<<<<]>>>>>-->[-]+<[-<<<<<+>>>>>]<<<<<[>>>>>>[-]<<<<<<[->>>>>+<<<<<]]>>>>>[-]>[-
+>[-]<]<<<<<<<<<<<<<<<<[-]>>>>>[-<<<<<++>>>>>]>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<+<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<+<<<<<<<<<<<<]>>>>>>>>>>
+>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>>>[-<<<-<+>>>>]<<<<[->>>>+<<<<]>>>[-]+<<[-<<<+
+>>>]<<<[>>>>>[-]<<<<<[->>>+<<<]]>>>[-]>>>>>[-]+<<<[-<<+<<<+>>>>>]<<<<<[->>>>>+<<
+<<<]>>>[->>>>>[-]<<<<<]<<<[-]<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>[<<<[-]+>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]]<[-]>>[-<+>]<[<[-]+>[->+<]]<<[
+-]<[->>[-<+>]<<]>>[-]>>>>>>[-<<<<<<<[<<<<<<<<<<<<->>>>>>>>>>>>>>>-<<<<[-]<<<<<<<
+<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[<<<[-]+>>>[-<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>]]<[-]>>[-<+>]<[<[-]+>[->+<]]<<[-]<[->>[-<+>]<<]>>[-]<]>>>>>>>]<<<<<
+<<[-]>[-]>>[-<+>]<[<[-]+>[->+<]]<<<[-]<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>[<<<[-]+>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]]<<<[->>[-]<<]>>>>>[-]
+<<<[-<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>+>>>
+]<<<[->>>+<<<]<]>>>>[-]<<[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[-]
+>[-]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+>
++<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>[-<<<<
+<-<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>[-]+<<<<<<<[->+<]>[>>>>>>[-]<<<<<<[-<+>
+]]<[-]>>>>[-]+>>>[-<<<<<<<+>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]<[->>>>[-]<<<<]>[-]<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[>[-]+<[-<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>]]<[-]<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[<[-]+>[-<<<<<<<<+>>>>>
+>>>]]>>[-]<[-<<[->>>+<<<]>>]<<[-]>>>>>[-<<[<<<<<<<<<<<<<<<<->>>>>>->>>>>>>>>[-]<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[>[-]+<[-<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>]]<[-]<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[<[-]+>[-<<<<<<<<+>>>
+>>>>>]]>>[-]<[-<<[->>>+<<<]>>]<<[-]>>>]>>]<<[-]<<<[-]<<<<<<<[->>>>>>>>+<<<<<<<<]
+>>>>>>>>[<[-]+>[-<<<<<<<<+>>>>>>>>]]>[-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>[>[-]+<[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]]>[-<<[-]>>]>>>>>>[-
+]<<<<<<<<[-<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>+>>>>>]<<<<<[->>>>>+<<<<<]<]>>>>>>[-]<<<<<<<<<<<<<[-<<<<<<+>>>>>>]<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<+<<<<<<<<<<<<<<]>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<+<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>>>>>[-<<<-<+>>>>]<
+<<<[->>>>+<<<<]>>>[-]+<<[-<<<+>>>]<<<[>>>>>[-]<<<<<[->>>+<<<]]>>>[-]>>>>>[-]+<<<
+[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>[->>>>>[-]<<<<<]<<<[-]<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[<<<[-]+>>>[-<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>]]<[-]>>[-<+>]<[<[-]+>[->+<]]<<[-]<[->>[-<+>]<<]>>[-]>>>>>>[-<<<<<<<[<
+<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>-<<<<[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<]>>>>>>>>>>>>>>>>[<<<[-]+>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]]<[-]>>[-
+<+>]<[<[-]+>[->+<]]<<[-]<[->>[-<+>]<<]>>[-]<]>>>>>>>]<<<<<<<[-]>[-]>>[-<+>]<[<[-
+]+>[->+<]]<<<[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>[<<<[-]+>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]]<<<[->>[-]<<]>>>>>[-]<<<[-<<<<<
+<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>+>>>]<
+<<[->>>+<<<]<]>>>>[-]<<[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>[-]+>>>>>>>]<<<<<<]>[-]>[-]<<<]<<<<<<<<<[->>>>>>>>>>>>>>>>>+<+<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>--------------
+-------------------------->[-]+<[-<+>]<[>>[-]<<[->+<]]>[-][-]+>[-<[-]<[-]+++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>]<[-<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>[-]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<[->>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++<[->-[>+>>]>
+[+[-<+>]>+>>]<<<<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>[-]>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<
+<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>><<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[
+->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]++++++++++++++++++++++++++++++++.[-]>>]>
+>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>-<<<<<[-]+>>>
+>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]++++
+++++++++++++++++++++++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<
+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>--<<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>
+>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]+++++++++++++++++++++++++++++++++
++++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>
+>>>>>>---<<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>
+>>[-]<<<<<[-<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>
+>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>----<<<<<[
+-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[
+-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+
+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>-----<<<<<[-]+>>>>>[-<<<
+<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]+++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>>>
+>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>------<<<<<[-]+>>>>>[-<<<<<<<+>>>>>
+>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]+++++++++++++++++++++
+++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+
+<<<<<<<<<]>>>>>>>-------<<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>
++<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]++++++++++++++++++++++++++++++++++++++++++.[-]>>
+]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>--------<<<
+<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-
+<<[-]+++++++++++++++++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<
+<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>---------<<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<
+<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]++++++++++++++++++++++++++
++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>
+>>>>----------<<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]
+>>>>>>>[-]<<<<<[-<<[-]++++++++++++++++++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+<
+<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>-----------<<<<<[-]+>>>>>
+[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]++++++
+++++++++++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>
+>>>>>>>+<<<<<<<<<]>>>>>>>------------<<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[
+-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]+++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>
+>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>-------------<<<<<[-]+>>>>>[-<<<<
+<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]
+>>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>---------
+-----<<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[->>>>>>>+<<<<<<<]]>>>>>>>[-
+]<<<<<[-<<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++.[-]>>]>>>>>>>[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+
+<<<<<<<<<]>>>>>>>---------------<<<<<[-]+>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[>>[-]<<[
+->>>>>>>+<<<<<<<]]>>>>>>>[-]<<<<<[-<<[-]++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>]>>>>>>>[-]<<<<<<<<]<<<[
+-]>[-]+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<+>>>>>>>>>>>>>]<<[->>>>>>>>>-<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>[-]+<<[
+-<<<<<<<+>>>>>>>]<<<<<<<[>>>>>>>>>[-]<<<<<<<<<[->>>>>>>+<<<<<<<]]>>>>>>>[-]>>>>[
+-]+<<[-<<+<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>[->>>>[-]<<<<]
+<<<<<<<[-]<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>
+>>>[<<<<<<<[-]+>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]]<<<<<<[-]<<[->>
+>>>>>>+<<<<<<<<]>>>>>>>>[<<<<<<[-]+>>>>>>[-<<<<<<<<+>>>>>>>>]]<<<<<[-]<<[->[->+<
+]<]>[-]>>>>>>>>>>[-<<<<<<<<<[<<<<<<<<<<<<<<->>>>>>>>>>>->[-]<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[<<<<<<<[-]+>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]]<<<<<<[-]<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[<<<<<
+<[-]+>>>>>>[-<<<<<<<<+>>>>>>>>]]<<<<<[-]<<[->[->+<]<]>[-]>]>>>>>>>>>]<<<<<<<<<[-
+]<[-]<<[->>>>>>>>+<<<<<<<<]>>>>>>>>[<<<<<<[-]+>>>>>>[-<<<<<<<<+>>>>>>>>]]<<<<<<<
+[-]<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[<<<
+<<<<[-]+>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]]<<<<<<<[->[-]<]>>>>>>>
+>>[-]<<<<<<<<[-<<<<<<<<<<<<<<[-]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<]<<<[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-]++++++++++.[-]<[-]>[-]++<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>]<<<[->>>>-<<+<<]>>[-<<+>>]>>>>>>>>>>>[-]+<<<<<<<<<[-<+>]<[>>>>>>>>>>[-]<<<
+<<<<<<<[->+<]]>[-]>>>>>>>[-]+>>[-<<<<<<<<<+<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<
+<<<<<<<<<]>[->>>>>>>[-]<<<<<<<]<[-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>[<[-]+>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]]<<[-]<[->>>+<<
+<]>>>[<<[-]+>>[-<<<+>>>]]>>>>>[-]<<<<<<[-<[->>>>>>>+<<<<<<<]>]<[-]>>>>>>>>>[-<<[
+<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>->>[-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>>>[<[-]+>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]]<<[-]<[-
+>>>+<<<]>>>[<<[-]+>>[-<<<+>>>]]>>>>>[-]<<<<<<[-<[->>>>>>>+<<<<<<<]>]<[-]>>>>>>>]
+>>]<<[-]<<<<<<<[-]<[->>>+<<<]>>>[<<[-]+>>[-<<<+>>>]]<[-]<<<<<<<<<<<<<<<[->>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[<[-]+>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>]]<[-<[-]>]>>>>>>>>>>[-]<<<<<<<<<<<[-<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>+<<<<]>>>>[-<<<<+>>>>]<<]<<[-]>[-<<<<<<<<<<<<<+>>>>>>>
+>>>>>>]<<<<<<<<<<<<<<<<]
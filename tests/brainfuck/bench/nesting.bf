@@ -0,0 +1,33 @@
+Deep nesting stress
+Runs 32 nested loops where the outer 20 go around twice each
+and the innermost body touches six accumulators
+Prints the accumulators as six characters and a newline
+
+[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]
+++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]++[>[-]+[>[-]+[>[-]+[>[-
+]+[>[-]+[>[-]+[>[-]+[>[-]+[>[-]+[>[-]+[>[-]+[>[-]+[>>>>>+++++++>+<<+++++++++++++
++++++++++++++++++++<<<<-]>>>+++++++++++++++++++++++++++++++<<<<-]>>>++++++++++++
+++++++++++++++++++<<<<-]>>>+++++++++++++++++++++++++++++<<<<-]>>>>>>>+++++++++++
++++++++++++++++++<<<<<<<<-]>>>>>>>+++++++++++++++++++++++++++<<<<<<<<-]>>>>>>>++
+++++++++++++++++++++++++<<<<<<<<-]>>>>>>>+++++++++++++++++++++++++<<<<<<<<-]>>>>
+>>>>>>>++++++++++++++++++++++++<<<<<<<<<<<<-]>>>>>>>>>>>+++++++++++++++++++++++<
+<<<<<<<<<<<-]>>>>>>>>>>>++++++++++++++++++++++<<<<<<<<<<<<-]>>>>>>>>>>>+++++++++
+++++++++++++<<<<<<<<<<<<-]>>>>>>>>>>>>>>>++++++++++++++++++++<<<<<<<<<<<<<<<<-]>
+>>>>>>>>>>>>>>+++++++++++++++++++<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>++++++++++++++
+++++<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>+++++++++++++++++<<<<<<<<<<<<<<<<-]>>>>>>>>
+>>>>>>>>>>>++++++++++++++++<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>++++++++++++
++++<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>++++++++++++++<<<<<<<<<<<<<<<<<<<<-]
+>>>>>>>>>>>>>>>>>>>+++++++++++++<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>+++
++++++++++<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>+++++++++++<<<<<<<<<<<
+<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>++++++++++<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>
+>>>>>>>>>>>>>>>>>+++++++++<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>+
++++++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++++++++++++++++++
++.>+++++++++++++++++++++++++++++++++.>+++++++++++++++++++++++++++++++++.>+++++++
+++++++++++++++++++++++++++.>+++++++++++++++++++++++++++++++++.>+++++++++++++++++
+++++++++++++++++.<<<<<[-]++++++++++.
@@ -0,0 +1,48 @@
+Sieve of Eratosthenes
+Prints every prime below 1500 in decimal on its own line
+Each candidate lives in a 16 cell block that is walked with scan loops
+
+>>>>>>>>>>>>>>>>>>>>>>>>[-]------------------------------------>[-]+++++>>>[-]<<
+<<[->>>>>+<<<<<]>>>>>[<[-]+>[-<<<<<+>>>>>]][-]<<<<[->>>>>+<<<<<]>>>>>[<[-]+>[-<<
+<<<+>>>>>]]<[-<+>]<[[-]<<<<<<<<<<<<[-]+>>>>>>>>>>>>>[-]+<<<<<[->>>>>>+<<<<<<]>>>
+>>>[<[-]>[-<<<<<<+>>>>>>]]<[-<<<<->>>>]<<<<<-[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+]>[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-]<<<<[->>>>>+<<<<<]>>
+>>>[<[-]+>[-<<<<<+>>>>>]][-]<<<<[->>>>>+<<<<<]>>>>>[<[-]+>[-<<<<<+>>>>>]]<[-<+>]
+<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-]++>>[-]++<<<<[>>>>>>>>>>>>[-]+<<<<<<<<<<<[->>>>>>>>>>>>+<<<
+<<<<<<<<<]>>>>>>>>>>>>[<[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]]<[->[-]>[-]<<<<<<<[->>>
+>>>>>+<<<<<<<<]>>>>>>>>[<[-]+>[-<<<<<<<<+>>>>>>>>]]<[-<+>]<[->+>+<<]>>[-<<+>>]<[
+[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.---------------------
+--------------------------->>>>>>>][-]<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[<[
+-]+>[-<<<<<<<<<+>>>>>>>>>]]<[-<+>]<[->+>+<<]>>[-<<+>>]<[[-]<<<<<<<<+++++++++++++
++++++++++++++++++++++++++++++++++++.--------------------------------------------
+---->>>>>>>>][-]<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[<[-]+>[-<<<<<<<<<<+>
+>>>>>>>>>]]<[-<+>]<[->+>+<<]>>[-<<+>>]<[[-]<<<<<<<<<++++++++++++++++++++++++++++
+++++++++++++++++++++.------------------------------------------------>>>>>>>>>]<
+[-]<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-------------------
+----------------------------->>>>>>>>>>[-]++++++++++.[-]<<<<<<<<<<<<[->>>>>>+>>>
+>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>+>>>
+>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>+>>>>+
+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>+>>>+<
+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<<<[-]>>>>>>>>[->>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>><<<<
+<<<<<<<[->>>>>>>>>>>>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>]<[[-]>[-]+<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>[<[-]>[-<<<<<<<+>>>>>>>]]<[-<<<<<
+->>>>>]<<<<<<->>>>>>[-]+<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>[<[-]>[-<<<<<<<+>>>>>>>]]
+<<<<<<[->>>>>>+<<<<<<]>>>>>>[<[-]>[-<<<<<<+>>>>>>]]<[-<<<<<<<<<<<<<[-]+>>>>>>>>>
+[-<<+>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[-<<+>>>>>>+<<<<]>>>>[-<<<<+>>>>]<]<<<
+<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>[->
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>><<<<<<<<<<<[->>>>>>>>>>>>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>]<]<<<<<[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<<<<
+<<][-]+>>>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>><<<<<+>>>>>>>>>>[-]+<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<
+<<]>>>>>>>>>>>[<[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]]<[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<+[
+->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<----------<[-]+>[->+<
+]>[<<[-]>>[-<+>]]<[-]<[-<<<<<<<<[-]>+[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<
++>>>>>>>>>]<----------<[-]+>[->+<]>[<<[-]>>[-<+>]]<[-]<[-<<<<<<<[-]>+[->>>>>>>+>
++<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<----------<[-]+>[->+<]>[<<[-]>>[-<+>]]<[-
+]<[-<<<<<<[-]>+>>>>>]]]<<<<<<<<<<<<]